@@ -3,16 +3,28 @@
  * Este código muestra cómo utilizar FreeRTOS en ESP32 generando el parpadeo de un LED.
  * Documentacion: https://www.freertos.org/Documentation/02-Kernel/02-Kernel-features/01-Tasks-and-co-routines/00-Tasks-and-co-routines
  *
+ * Con HR_SCHED_EN el LED se alterna con hr_sched (esp_timer): período en
+ * microsegundos y sin deriva, en lugar de vTaskDelay a resolución de tick.
+ *
  * GPIO:
  * GPIO2: Salida conectada al LED
  *
  * Fecha: 23/05/2024
  * Autores: Espindola Agustin, Glas Sebastian
  */
+#include <stdio.h>
 #include "FreeRTOSConfig.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/gpio.h"
+#include "stack_prof.h"
+#include "hr_sched.h"
+
+// Descomentar para alternar el LED con hr_sched en lugar de vTaskDelay
+//#define HR_SCHED_EN
+
+// Descomentar para informar periódicamente el peor caso de pila de todas las tareas
+//#define STACK_PROF_EN
 
 // Definir el núcleo a utilizar
 #if CONFIG_FREERTOS_UNICORE
@@ -24,9 +36,28 @@ static const BaseType_t app_cpu = 1;
 // GPIO
 static const int GPIO_LED = GPIO_NUM_2;
 
+#ifdef HR_SCHED_EN
+// Medio período del parpadeo
+static const uint32_t BLINK_HALF_US = 500000;
+
+static hr_sched_t hr;
+#endif
+
 // Definición de tareas (parpadeo del LED)
 void toggleLED(void *parameter)
 {
+#ifdef HR_SCHED_EN
+    // Cada cambio vence medio período después del anterior, no del final de la vuelta
+    int64_t wake = hr_now_us();
+
+    while(1)
+    {
+         gpio_set_level(GPIO_LED, 0);
+        hr_sleep_until(&hr, &wake, BLINK_HALF_US);
+         gpio_set_level(GPIO_LED, 1);
+        hr_sleep_until(&hr, &wake, BLINK_HALF_US);
+    }
+#else
     while(1)
     {
          gpio_set_level(GPIO_LED, 0);
@@ -34,10 +65,16 @@ void toggleLED(void *parameter)
          gpio_set_level(GPIO_LED, 1);
         vTaskDelay(500/portTICK_PERIOD_MS);
     }
+#endif
 }
 
 void app_main() 
 {
+#ifdef STACK_PROF_EN
+    // Informe de pila de todas las tareas, también las del sistema (IDLE, Tmr Svc, esp_timer)
+    stack_prof_start(STACK_PROF_DEFAULT_PERIOD_MS, STACK_PROF_DEFAULT_MARGIN, 1, tskNO_AFFINITY);
+#endif
+
     // Estructura de configuración de GPIO
     //(https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/gpio.html#_CPPv413gpio_config_t)
     gpio_config_t io_config = {
@@ -51,6 +88,14 @@ void app_main()
     // Función para configurar GPIO
     gpio_config(&io_config);
 
+#ifdef HR_SCHED_EN
+    if (!hr_sched_init(&hr))
+    {
+        printf("No se pudo iniciar hr_sched\n");
+        return;
+    }
+#endif
+
     // Creación de tareas
     xTaskCreatePinnedToCore(
         toggleLED,      // Función a llamar
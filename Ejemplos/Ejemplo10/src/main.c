@@ -2,6 +2,8 @@
  * 
  * Resumen:
  * Demostrar inversión de prioridades.
+ * Con LOG_MUX_EN los mensajes de las tareas son registros completos en
+ * log_mux y una tarea de drenado en el núcleo 0 los imprime en orden.
  * Documentacion: https://www.digikey.com/en/maker/projects/introduction-to-rtos-solution-to-part-11-priority-inversion/abf4b8f7cd4a4c70bece35678d178321
  *
  * Configuración GPIO:
@@ -17,6 +19,35 @@
 
 #include "freertos/FreeRTOS.h"
 #include "esp_task_wdt.h"
+#include "lock_prof.h"
+#include "log_mux.h"
+#include "stack_prof.h"
+
+// Descomentar para medir la contención de los bloqueos (reporte con 'l' o cada LOCK_PROF_DUMP_MS)
+//#define LOCK_PROF_EN
+#define LOCK_PROF_DUMP_MS 10000
+
+// Descomentar para informar periódicamente el peor caso de pila de todas las tareas
+//#define STACK_PROF_EN
+
+// Descomentar para que cada mensaje sea un registro completo en log_mux en lugar de un printf
+//#define LOG_MUX_EN
+
+#ifdef LOG_MUX_EN
+  #define LOG_INIT()        uint8_t log_src = log_mux_register_self(&log_mux)
+  #define LOG(...)          log_mux_printf(&log_mux, log_src, __VA_ARGS__)
+#else
+  #define LOG_INIT()
+  #define LOG(...)          printf(__VA_ARGS__)
+#endif
+
+#ifdef LOCK_PROF_EN
+  #define TAKE(sem, ticks)  lock_prof_take(sem, ticks)
+  #define GIVE(sem)         lock_prof_give(sem)
+#else
+  #define TAKE(sem, ticks)  xSemaphoreTake(sem, ticks)
+  #define GIVE(sem)         xSemaphoreGive(sem)
+#endif
 
 // Usar solo el núcleo 1 para propósitos de demostración
 #if CONFIG_FREERTOS_UNICORE
@@ -34,6 +65,12 @@ TickType_t med_wait = 5000; // Tiempo que la tarea de prioridad media pasa traba
 
 // Variables globales
 static SemaphoreHandle_t lock;
+#ifdef LOG_MUX_EN
+// Multiplexor de registros: las tareas producen y solo el drenado escribe en la consola
+static log_mux_t log_mux;
+static uart_tx_backend_t log_be;
+static uart_tx_stage_t log_stage;
+#endif
 
 //*****************************************************************************
 // Tareas
@@ -42,25 +79,26 @@ static SemaphoreHandle_t lock;
 void doTaskL(void *parameters) {
 
   TickType_t timestamp;
+  LOG_INIT();
 
   // Hacer para siempre
   while (1) {
 
     // Tomar el bloqueo
-    printf("Tarea L intentando tomar el bloqueo...\n");
+    LOG("Tarea L intentando tomar el bloqueo...\n");
     timestamp = xTaskGetTickCount() * portTICK_PERIOD_MS;
-    xSemaphoreTake(lock, portMAX_DELAY);
+    TAKE(lock, portMAX_DELAY);
 
     // Indicar cuánto tiempo pasamos esperando el bloqueo
-    printf("Tarea L obtuvo el bloqueo. Pasó %lu ms esperando el bloqueo. Haciendo algo de trabajo...\n", (xTaskGetTickCount() * portTICK_PERIOD_MS) - timestamp);
+    LOG("Tarea L obtuvo el bloqueo. Pasó %lu ms esperando el bloqueo. Haciendo algo de trabajo...\n", (xTaskGetTickCount() * portTICK_PERIOD_MS) - timestamp);
 
     // Acaparar el procesador durante un tiempo sin hacer nada
     timestamp = xTaskGetTickCount() * portTICK_PERIOD_MS;
     while ( (xTaskGetTickCount() * portTICK_PERIOD_MS) - timestamp < cs_wait);
 
     // Liberar el bloqueo
-    printf("Tarea L liberando el bloqueo.\n");
-    xSemaphoreGive(lock);
+    LOG("Tarea L liberando el bloqueo.\n");
+    GIVE(lock);
 
     // Ir a dormir
     vTaskDelay(500 / portTICK_PERIOD_MS);
@@ -71,17 +109,18 @@ void doTaskL(void *parameters) {
 void doTaskM(void *parameters) {
 
   TickType_t timestamp;
+  LOG_INIT();
 
   // Hacer para siempre
   while (1) {
 
     // Acaparar el procesador durante un tiempo sin hacer nada
-    printf("Tarea M haciendo algo de trabajo...\n");
+    LOG("Tarea M haciendo algo de trabajo...\n");
     timestamp = xTaskGetTickCount() * portTICK_PERIOD_MS;
     while ( (xTaskGetTickCount() * portTICK_PERIOD_MS) - timestamp < med_wait);
 
     // Ir a dormir
-    printf("¡Tarea M terminada!\n");
+    LOG("¡Tarea M terminada!\n");
     vTaskDelay(500 / portTICK_PERIOD_MS);
   }
 }
@@ -90,25 +129,26 @@ void doTaskM(void *parameters) {
 void doTaskH(void *parameters) {
 
   TickType_t timestamp;
+  LOG_INIT();
 
   // Hacer para siempre
   while (1) {
 
     // Tomar el bloqueo
-    printf("Tarea H intentando tomar el bloqueo...\n");
+    LOG("Tarea H intentando tomar el bloqueo...\n");
     timestamp = xTaskGetTickCount() * portTICK_PERIOD_MS;
-    xSemaphoreTake(lock, portMAX_DELAY);
+    TAKE(lock, portMAX_DELAY);
 
     // Indicar cuánto tiempo pasamos esperando el bloqueo
-    printf("Tarea H obtuvo el bloqueo. Pasó %lu ms esperando el bloqueo. Haciendo algo de trabajo...\n", (xTaskGetTickCount() * portTICK_PERIOD_MS) - timestamp);
+    LOG("Tarea H obtuvo el bloqueo. Pasó %lu ms esperando el bloqueo. Haciendo algo de trabajo...\n", (xTaskGetTickCount() * portTICK_PERIOD_MS) - timestamp);
 
     // Acaparar el procesador durante un tiempo sin hacer nada
     timestamp = xTaskGetTickCount() * portTICK_PERIOD_MS;
     while ( (xTaskGetTickCount() * portTICK_PERIOD_MS) - timestamp < cs_wait);
 
     // Liberar el bloqueo
-    printf("Tarea H liberando el bloqueo.\n");
-    xSemaphoreGive(lock);
+    LOG("Tarea H liberando el bloqueo.\n");
+    GIVE(lock);
     
     // Ir a dormir
     vTaskDelay(500 / portTICK_PERIOD_MS);
@@ -119,6 +159,11 @@ void doTaskH(void *parameters) {
 // Principal (se ejecuta como su propia tarea con prioridad 1 en el núcleo 1)
 
 void app_main() {
+#ifdef STACK_PROF_EN
+    // Informe de pila de todas las tareas, también las del sistema (IDLE, Tmr Svc, esp_timer)
+    stack_prof_start(STACK_PROF_DEFAULT_PERIOD_MS, STACK_PROF_DEFAULT_MARGIN, 1, tskNO_AFFINITY);
+#endif
+
     // Configurar Serial
 
     // Esperar un momento para comenzar (para no perder la salida Serial)
@@ -132,6 +177,20 @@ void app_main() {
     #else
       lock = xSemaphoreCreateMutex();
     #endif
+
+#ifdef LOG_MUX_EN
+    // Drenado hacia la consola en el núcleo 0, fuera del alcance de la tarea M
+    log_mux_init(&log_mux);
+    uart_tx_backend_stdout(&log_be);
+    uart_tx_stage_init(&log_stage, &log_be, UART_TX_STAGE_LEN, portMAX_DELAY);
+    log_mux_start(&log_mux, &log_stage, LOG_MUX_DEFAULT_DRAIN_MS, 1, 0);
+#endif
+
+#ifdef LOCK_PROF_EN
+    // Registrar los bloqueos y arrancar el monitor en el núcleo 0
+    lock_prof_register(lock, "lock");
+    lock_prof_start(LOCK_PROF_DUMP_MS, 1, 0);
+#endif
     
 
     // El orden de inicio de las tareas importa para forzar la inversión de prioridades
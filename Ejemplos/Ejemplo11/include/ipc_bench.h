@@ -0,0 +1,29 @@
+/**
+ *
+ * Resumen:
+ * Medición de los mecanismos de comunicación entre tareas del kernel: colas,
+ * semáforos, notificaciones de tarea, stream buffers y message buffers.
+ *
+ * Para cada mecanismo, tamaño de carga y disposición de tareas (mismo núcleo
+ * con distintas prioridades, o entre núcleos) se mide:
+ * - Ida y vuelta: una tarea envía y espera la respuesta de la otra por el
+ *   mismo tipo de mecanismo (ns promedio por ida y vuelta).
+ * - Caudal: una tarea envía BENCH_ITEMS elementos tan rápido como puede y la
+ *   otra los recibe (elementos por segundo).
+ *
+ * El resultado es un CSV entre las líneas IPC_BENCH_BEGIN e IPC_BENCH_END,
+ * cada fila con el prefijo "BENCH," para separarlo del resto del monitor.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef IPC_BENCH_H
+#define IPC_BENCH_H
+
+/**
+ * @brief Correr todos los casos e imprimir el reporte
+ */
+void ipc_bench_run(void);
+
+#endif // IPC_BENCH_H
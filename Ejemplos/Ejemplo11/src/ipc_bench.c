@@ -0,0 +1,373 @@
+/**
+ *
+ * Resumen:
+ * Implementación de la medición de comunicación entre tareas (ver ipc_bench.h).
+ *
+ * Cada mecanismo se describe con una tabla de funciones (crear, borrar,
+ * enviar, recibir) sobre un canal de un sentido; cada caso usa dos canales
+ * (ida y vuelta) y dos tareas nuevas que arrancan juntas desde un semáforo.
+ *
+ * El tiempo sale de esp_timer en el ESP32 y de clock_gettime en el puerto de
+ * Linux; como se promedia sobre muchas operaciones la resolución de 1 us de
+ * esp_timer alcanza.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/stream_buffer.h"
+#include "freertos/message_buffer.h"
+#include "ipc_bench.h"
+
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#include "esp_timer.h"
+static inline uint64_t bench_now_ns(void)
+{
+  return (uint64_t)esp_timer_get_time() * 1000u;
+}
+#else
+#include <time.h>
+static inline uint64_t bench_now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+#endif
+
+// Configuración
+#define BENCH_ROUNDS      (1000)    // Idas y vueltas por caso
+#define BENCH_ITEMS       (5000)    // Elementos por caso de caudal
+#define BENCH_MUTEX_OPS   (10000)   // Tomar y devolver el mutex sin contención
+#define BENCH_DEPTH       (8)       // Elementos que entran en cada canal
+#define BENCH_MAX_SIZE    (128)
+#define BENCH_STACK       (3072)
+
+#if CONFIG_FREERTOS_UNICORE || CONFIG_IDF_TARGET_LINUX
+  #define BENCH_CROSS_CORE  (0)
+#else
+  #define BENCH_CROSS_CORE  (1)
+#endif
+
+//*****************************************************************************
+// Mecanismos
+
+// Canal de un sentido
+typedef struct {
+  union {
+    QueueHandle_t queue;
+    SemaphoreHandle_t sem;
+    StreamBufferHandle_t stream;
+    MessageBufferHandle_t msg;
+  };
+  TaskHandle_t receiver;            // Tarea a notificar
+} bench_chan_t;
+
+typedef struct {
+  const char *name;
+  bool sized;                       // Si lleva carga (si no, se mide con tamaño 0)
+  bool (*create)(bench_chan_t *ch, uint32_t size);
+  void (*destroy)(bench_chan_t *ch);
+  void (*send)(bench_chan_t *ch, const uint8_t *data, uint32_t size);
+  void (*recv)(bench_chan_t *ch, uint8_t *data, uint32_t size);
+} ipc_ops_t;
+
+// Cola
+static bool queue_create(bench_chan_t *ch, uint32_t size)
+{
+  ch->queue = xQueueCreate(BENCH_DEPTH, size);
+  return ch->queue != NULL;
+}
+
+static void queue_destroy(bench_chan_t *ch)
+{
+  vQueueDelete(ch->queue);
+}
+
+static void queue_send(bench_chan_t *ch, const uint8_t *data, uint32_t size)
+{
+  xQueueSend(ch->queue, data, portMAX_DELAY);
+}
+
+static void queue_recv(bench_chan_t *ch, uint8_t *data, uint32_t size)
+{
+  xQueueReceive(ch->queue, data, portMAX_DELAY);
+}
+
+// Semáforo contador (no pierde entregas en la prueba de caudal)
+static bool sem_create(bench_chan_t *ch, uint32_t size)
+{
+  ch->sem = xSemaphoreCreateCounting(BENCH_ITEMS, 0);
+  return ch->sem != NULL;
+}
+
+static void sem_destroy(bench_chan_t *ch)
+{
+  vSemaphoreDelete(ch->sem);
+}
+
+static void sem_send(bench_chan_t *ch, const uint8_t *data, uint32_t size)
+{
+  xSemaphoreGive(ch->sem);
+}
+
+static void sem_recv(bench_chan_t *ch, uint8_t *data, uint32_t size)
+{
+  xSemaphoreTake(ch->sem, portMAX_DELAY);
+}
+
+// Notificación de tarea (como contador: cada entrega se consume de a una)
+static bool notify_create(bench_chan_t *ch, uint32_t size)
+{
+  ch->receiver = NULL;
+  return true;
+}
+
+static void notify_destroy(bench_chan_t *ch)
+{
+}
+
+static void notify_send(bench_chan_t *ch, const uint8_t *data, uint32_t size)
+{
+  xTaskNotifyGive(ch->receiver);
+}
+
+static void notify_recv(bench_chan_t *ch, uint8_t *data, uint32_t size)
+{
+  ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+}
+
+// Stream buffer (se despierta al receptor con un elemento completo)
+static bool stream_create(bench_chan_t *ch, uint32_t size)
+{
+  ch->stream = xStreamBufferCreate(BENCH_DEPTH * size, size);
+  return ch->stream != NULL;
+}
+
+static void stream_destroy(bench_chan_t *ch)
+{
+  vStreamBufferDelete(ch->stream);
+}
+
+static void stream_send(bench_chan_t *ch, const uint8_t *data, uint32_t size)
+{
+  size_t done = 0;
+
+  while (done < size) {
+    done += xStreamBufferSend(ch->stream, data + done, size - done, portMAX_DELAY);
+  }
+}
+
+static void stream_recv(bench_chan_t *ch, uint8_t *data, uint32_t size)
+{
+  size_t done = 0;
+
+  while (done < size) {
+    done += xStreamBufferReceive(ch->stream, data + done, size - done, portMAX_DELAY);
+  }
+}
+
+// Message buffer (cada mensaje lleva además su largo)
+static bool msg_create(bench_chan_t *ch, uint32_t size)
+{
+  ch->msg = xMessageBufferCreate(BENCH_DEPTH * (size + sizeof(size_t)));
+  return ch->msg != NULL;
+}
+
+static void msg_destroy(bench_chan_t *ch)
+{
+  vMessageBufferDelete(ch->msg);
+}
+
+static void msg_send(bench_chan_t *ch, const uint8_t *data, uint32_t size)
+{
+  xMessageBufferSend(ch->msg, data, size, portMAX_DELAY);
+}
+
+static void msg_recv(bench_chan_t *ch, uint8_t *data, uint32_t size)
+{
+  xMessageBufferReceive(ch->msg, data, size, portMAX_DELAY);
+}
+
+static const ipc_ops_t mechanisms[] = {
+  { "cola",           true,  queue_create,  queue_destroy,  queue_send,  queue_recv },
+  { "semaforo",       false, sem_create,    sem_destroy,    sem_send,    sem_recv },
+  { "notificacion",   false, notify_create, notify_destroy, notify_send, notify_recv },
+  { "stream_buffer",  true,  stream_create, stream_destroy, stream_send, stream_recv },
+  { "message_buffer", true,  msg_create,    msg_destroy,    msg_send,    msg_recv },
+};
+
+static const uint32_t sizes[] = { 4, 32, BENCH_MAX_SIZE };
+
+//*****************************************************************************
+// Disposición de las tareas
+
+typedef struct {
+  const char *name;
+  BaseType_t core_tx;
+  BaseType_t core_rx;
+  UBaseType_t prio_tx;
+  UBaseType_t prio_rx;
+} bench_arr_t;
+
+static const bench_arr_t arrangements[] = {
+  { "mismo_nucleo_igual_prio",  0, 0, 5, 5 },
+  { "mismo_nucleo_rx_mayor",    0, 0, 5, 6 },
+  { "mismo_nucleo_rx_menor",    0, 0, 6, 5 },
+#if BENCH_CROSS_CORE
+  { "entre_nucleos",            0, 1, 5, 5 },
+#endif
+};
+
+//*****************************************************************************
+// Casos
+
+typedef struct {
+  const ipc_ops_t *ops;
+  uint32_t size;
+  bench_chan_t fwd;                 // Emisor -> receptor
+  bench_chan_t back;                // Receptor -> emisor (respuesta)
+  uint64_t rtt_ns;
+  uint64_t t_start;                 // Primer envío del caudal
+  uint64_t t_end;                   // Última recepción del caudal
+} bench_case_t;
+
+static SemaphoreHandle_t start_sem;
+static SemaphoreHandle_t done_sem;
+
+// Emisor: ida y vuelta y después caudal
+static void benchTx(void *parameters)
+{
+  bench_case_t *c = (bench_case_t *)parameters;
+  uint8_t buf[BENCH_MAX_SIZE];
+
+  memset(buf, 0x5A, sizeof(buf));
+  xSemaphoreTake(start_sem, portMAX_DELAY);
+
+  uint64_t t0 = bench_now_ns();
+  for (int i = 0; i < BENCH_ROUNDS; i++) {
+    c->ops->send(&c->fwd, buf, c->size);
+    c->ops->recv(&c->back, buf, c->size);
+  }
+  c->rtt_ns = (bench_now_ns() - t0) / BENCH_ROUNDS;
+
+  c->t_start = bench_now_ns();
+  for (int i = 0; i < BENCH_ITEMS; i++) {
+    c->ops->send(&c->fwd, buf, c->size);
+  }
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+// Receptor: responde cada ida y después recibe el caudal
+static void benchRx(void *parameters)
+{
+  bench_case_t *c = (bench_case_t *)parameters;
+  uint8_t buf[BENCH_MAX_SIZE];
+
+  xSemaphoreTake(start_sem, portMAX_DELAY);
+
+  for (int i = 0; i < BENCH_ROUNDS; i++) {
+    c->ops->recv(&c->fwd, buf, c->size);
+    c->ops->send(&c->back, buf, c->size);
+  }
+
+  for (int i = 0; i < BENCH_ITEMS; i++) {
+    c->ops->recv(&c->fwd, buf, c->size);
+  }
+  c->t_end = bench_now_ns();
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static void run_case(const ipc_ops_t *ops, uint32_t size, const bench_arr_t *arr)
+{
+  static bench_case_t c;
+  TaskHandle_t tx = NULL;
+  TaskHandle_t rx = NULL;
+
+  memset(&c, 0, sizeof(c));
+  c.ops = ops;
+  c.size = size;
+  if (!ops->create(&c.fwd, size) || !ops->create(&c.back, size)) {
+    printf("ERROR: no se pudo crear %s de %lu bytes\n", ops->name, (unsigned long)size);
+    return;
+  }
+
+  // Las tareas esperan el semáforo de arranque: los receptores se anotan antes
+  xTaskCreatePinnedToCore(benchRx, "Rx", BENCH_STACK, &c, arr->prio_rx, &rx, arr->core_rx);
+  xTaskCreatePinnedToCore(benchTx, "Tx", BENCH_STACK, &c, arr->prio_tx, &tx, arr->core_tx);
+  c.fwd.receiver = rx;
+  c.back.receiver = tx;
+  xSemaphoreGive(start_sem);
+  xSemaphoreGive(start_sem);
+
+  xSemaphoreTake(done_sem, portMAX_DELAY);
+  xSemaphoreTake(done_sem, portMAX_DELAY);
+
+  uint64_t dt = c.t_end - c.t_start;
+  printf("BENCH,%s,%lu,%s,%lu,%lu\n", ops->name, (unsigned long)size, arr->name,
+         (unsigned long)c.rtt_ns,
+         (unsigned long)(dt ? (uint64_t)BENCH_ITEMS * 1000000000u / dt : 0));
+
+  ops->destroy(&c.fwd);
+  ops->destroy(&c.back);
+
+  // Dejar que la tarea inactiva libere las tareas borradas
+  vTaskDelay(1);
+}
+
+// Mutex sin contención: costo de tomar y devolver en la misma tarea
+static void run_mutex(void)
+{
+  SemaphoreHandle_t mutex = xSemaphoreCreateMutex();
+
+  uint64_t t0 = bench_now_ns();
+  for (int i = 0; i < BENCH_MUTEX_OPS; i++) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    xSemaphoreGive(mutex);
+  }
+  uint64_t dt = bench_now_ns() - t0;
+
+  printf("BENCH,mutex,0,sin_contencion,%lu,%lu\n",
+         (unsigned long)(dt / BENCH_MUTEX_OPS),
+         (unsigned long)(dt ? (uint64_t)BENCH_MUTEX_OPS * 1000000000u / dt : 0));
+
+  vSemaphoreDelete(mutex);
+}
+
+void ipc_bench_run(void)
+{
+  start_sem = xSemaphoreCreateCounting(2, 0);
+  done_sem = xSemaphoreCreateCounting(2, 0);
+
+  printf("IPC_BENCH_BEGIN\n");
+  printf("BENCH,mecanismo,bytes,disposicion,ida_vuelta_ns,elem_por_s\n");
+
+  for (size_t m = 0; m < sizeof(mechanisms) / sizeof(mechanisms[0]); m++) {
+    const ipc_ops_t *ops = &mechanisms[m];
+    size_t num_sizes = ops->sized ? sizeof(sizes) / sizeof(sizes[0]) : 1;
+
+    for (size_t s = 0; s < num_sizes; s++) {
+      for (size_t a = 0; a < sizeof(arrangements) / sizeof(arrangements[0]); a++) {
+        run_case(ops, ops->sized ? sizes[s] : 0, &arrangements[a]);
+      }
+    }
+  }
+  run_mutex();
+
+  printf("IPC_BENCH_END\n");
+
+  vSemaphoreDelete(start_sem);
+  vSemaphoreDelete(done_sem);
+}
@@ -0,0 +1,63 @@
+/**
+ *
+ * Resumen:
+ * Medir el costo de los mecanismos de comunicación entre tareas: colas,
+ * semáforos, notificaciones de tarea, stream buffers, message buffers y
+ * mutex. Se mide ida y vuelta y caudal para varios tamaños de carga, con las
+ * tareas en el mismo núcleo (con distintas prioridades) o en núcleos
+ * distintos, y se imprime un CSV (filas "BENCH,") para comparar entre
+ * versiones.
+ *
+ * También corre en el puerto de FreeRTOS para Linux de ESP-IDF, sin placa:
+ *   idf.py --preview set-target linux
+ *   idf.py build monitor
+ * (ahí no hay caso entre núcleos).
+ *
+ * Configuración GPIO:
+ * GPIO1 y 3 usados para UART0
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ipc_bench.h"
+#include "stack_prof.h"
+
+// Comentar para correr la medición una sola vez
+#define IPC_BENCH_REPEAT_EN
+
+// Descomentar para informar periódicamente el peor caso de pila de todas las tareas
+//#define STACK_PROF_EN
+
+// Configuración
+#define IPC_BENCH_PERIOD_MS   (10000)   // Pausa entre corridas
+
+//*****************************************************************************
+// Main (se ejecuta como su propia tarea con prioridad 1 en el núcleo 0)
+void app_main() {
+#ifdef STACK_PROF_EN
+    // Informe de pila de todas las tareas, también las del sistema (IDLE, Tmr Svc, esp_timer)
+    stack_prof_start(STACK_PROF_DEFAULT_PERIOD_MS, STACK_PROF_DEFAULT_MARGIN, 1, tskNO_AFFINITY);
+#endif
+
+    // Esperar un momento para comenzar (para no perder la salida Serial)
+    vTaskDelay(1000 / portTICK_PERIOD_MS);
+    printf("\n---Medición de comunicación entre tareas en FreeRTOS---\n");
+
+    while(1){
+        ipc_bench_run();
+#ifndef IPC_BENCH_REPEAT_EN
+        break;
+#endif
+        vTaskDelay(IPC_BENCH_PERIOD_MS / portTICK_PERIOD_MS);
+    }
+
+    while(1){
+        // No hacer nada, pero permitir ceder a tareas de menor prioridad
+        vTaskDelay(1000 / portTICK_PERIOD_MS);
+    }
+}
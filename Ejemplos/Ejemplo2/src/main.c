@@ -2,6 +2,15 @@
  * Resumen:
  * Este código muestra cómo usar FreeRTOS para crear dos 
  * tareas con prioridades diferentes.
+ * Cada tarea escribe en su propio buffer de preparación (uart_tx) que se
+ * entrega al driver en lotes, por tamaño o por plazo, en lugar de byte a byte.
+ * Una tarea de envío de baja prioridad cumple el plazo aunque la tarea deje
+ * de escribir.
+ * Con LOG_MUX_EN cada tarea publica registros completos en un multiplexor
+ * lock-free (log_mux) y una tarea de drenado de baja prioridad los emite
+ * enteros y en orden, con marca de tiempo, tarea y núcleo.
+ * Con HR_SCHED_EN Task1 espacia los caracteres con hr_sched (esp_timer) a
+ * exactamente CHAR_PERIOD_US, en lugar de vTaskDelay(10 ms), que es un tick.
  * Documentacion: https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/uart.html
  *				  https://www.freertos.org/Documentation/02-Kernel/02-Kernel-features/01-Tasks-and-co-routines/03-Task-priorities
  *
@@ -19,6 +28,28 @@
 #include "freertos/task.h"
 #include "driver/gpio.h"
 #include "driver/uart.h"
+#include "uart_tx.h"
+#include "log_mux.h"
+#include "hr_sched.h"
+#include "stack_prof.h"
+
+// Descomentar para medir la capa de transmisión al iniciar
+//#define TX_BENCH_EN
+
+// Descomentar para que las tareas escriban registros completos a través del multiplexor
+//#define LOG_MUX_EN
+
+// Descomentar para medir el costo de los productores del multiplexor al iniciar
+//#define LOG_BENCH_EN
+
+// Descomentar para espaciar los caracteres de Task1 con resolución de microsegundos
+//#define HR_SCHED_EN
+
+// Descomentar para comparar el período logrado con vTaskDelay y hr_sched al iniciar
+//#define HR_BENCH_EN
+
+// Descomentar para informar periódicamente el peor caso de pila de todas las tareas
+//#define STACK_PROF_EN
 
 // Definir el núcleo a utilizar
 #if CONFIG_FREERTOS_UNICORE
@@ -35,6 +66,13 @@ static const BaseType_t app_cpu = 1;
 #define UART_TX_BUF_SIZE   (512)
 #define UART_RX_BUF_SIZE   (512)
 
+// Definiciones de la transmisión por lotes
+#define TX_FLUSH_LEN       (16)     // Bytes acumulados que fuerzan un envío
+#define TX_MAX_DELAY_MS    (100)    // Tiempo máximo que un byte espera en el buffer
+
+// Separación entre caracteres de Task1 con HR_SCHED_EN
+#define CHAR_PERIOD_US     (10000)
+
 // Un string para enviar por el puerto
 const char msg[] = "tecnicas digitales en accion procesando en el nucleo 0";
 
@@ -42,6 +80,27 @@ const char msg[] = "tecnicas digitales en accion procesando en el nucleo 0";
 static TaskHandle_t task_1 = NULL;
 static TaskHandle_t task_2 = NULL;
 
+// Destino común y un buffer de preparación por tarea
+static uart_tx_backend_t uart_be;
+static uart_tx_stage_t stage_1;
+static uart_tx_stage_t stage_2;
+static uart_tx_flusher_t flusher;
+
+// Pedido a Task1 de terminar (envía lo pendiente y se elimina a sí misma)
+static volatile bool stop_task_1 = false;
+
+#ifdef HR_SCHED_EN
+static hr_sched_t hr;
+#endif
+
+#ifdef LOG_MUX_EN
+// Multiplexor de registros: las tareas producen y solo el drenado escribe en la UART
+static log_mux_t mux;
+static uart_tx_stage_t stage_drain;
+static uint8_t src_1;
+static uint8_t src_2;
+#endif
+
 // Tareas
 // Task1 imprime en el terminal serial con baja prioridad
 void startTask1(void *parameter)
@@ -49,35 +108,72 @@ void startTask1(void *parameter)
     // Contar el número de caracteres en el string
     int msg_len = strlen(msg);
 
-    char jump [] = "\n";
+#ifdef LOG_MUX_EN
+    // El mensaje completo es un único registro: no se mezcla con el de Task2
+    while(!stop_task_1)
+    {
+        log_mux_write(&mux, src_1, msg, msg_len);
+        vTaskDelay(1000/ portTICK_PERIOD_MS);
+    }
+#else
+    static const char jump [] = "\n";
 
     // Imprimir el string en el terminal serial
-    while(1)
+    while(!stop_task_1)
     {
-        uart_write_bytes(UART_PORT_NUM, jump, 1);
+        // Cadena constante: se envía sin copiar al buffer
+        uart_tx_write_static(&stage_1, jump, 1);
+#ifdef HR_SCHED_EN
+        int64_t wake = hr_now_us();
+#endif
         for(int i=0; i<msg_len; i++)
         {
-            uart_write_bytes(UART_PORT_NUM, &msg[i], 1);
+            // El byte queda en el buffer hasta completar TX_FLUSH_LEN o TX_MAX_DELAY_MS
+            uart_tx_write(&stage_1, &msg[i], 1);
+#ifdef HR_SCHED_EN
+            // Relativo al caracter anterior: el tiempo de uart_tx_write no se acumula
+            hr_sleep_until(&hr, &wake, CHAR_PERIOD_US);
+#else
             vTaskDelay(10/ portTICK_PERIOD_MS);
+#endif
         }
-        uart_write_bytes(UART_PORT_NUM, jump, 1);
+        uart_tx_write(&stage_1, jump, 1);
+        uart_tx_flush(&stage_1);
         vTaskDelay(1000/ portTICK_PERIOD_MS);
     }
+
+    // Lo que quede en el buffer se perdería al eliminar la tarea
+    uart_tx_flush(&stage_1);
+#endif
+    vTaskDelete(NULL);
 }
 
 // Task2 imprime en el terminal serial con prioridad superior
 void startTask2 (void *parameter)
 {
     char text [] = "x";
+#ifdef LOG_MUX_EN
+    while(1)
+    {
+        log_mux_write(&mux, src_2, text, 1);
+        vTaskDelay(100/ portTICK_PERIOD_MS);
+    }
+#else
     while(1)
     {
-        uart_write_bytes(UART_PORT_NUM, text, 1);
+        uart_tx_write(&stage_2, text, 1);
         vTaskDelay(100/ portTICK_PERIOD_MS);
     }
+#endif
 }
 
 void app_main() 
 {
+#ifdef STACK_PROF_EN
+    // Informe de pila de todas las tareas, también las del sistema (IDLE, Tmr Svc, esp_timer)
+    stack_prof_start(STACK_PROF_DEFAULT_PERIOD_MS, STACK_PROF_DEFAULT_MARGIN, 1, tskNO_AFFINITY);
+#endif
+
     // Configuración de la UART
     uart_config_t uart_config = {
         .baud_rate = UART_BAUD_RATE,
@@ -97,6 +193,63 @@ void app_main()
     // Instalar el controlador UART
     uart_driver_install(UART_PORT_NUM, UART_RX_BUF_SIZE * 2, UART_TX_BUF_SIZE * 2, 0, NULL, 0);
 
+    // Preparar la transmisión por lotes (un buffer por tarea)
+    uart_tx_backend_uart(&uart_be, UART_PORT_NUM);
+    uart_tx_stage_init(&stage_1, &uart_be, TX_FLUSH_LEN, TX_MAX_DELAY_MS / portTICK_PERIOD_MS);
+    uart_tx_stage_init(&stage_2, &uart_be, TX_FLUSH_LEN, TX_MAX_DELAY_MS / portTICK_PERIOD_MS);
+
+#ifdef TX_BENCH_EN
+    // Backend nulo: solo el costo de la capa
+    static uart_tx_backend_t null_be;
+    uart_tx_backend_null(&null_be);
+    uart_tx_benchmark(&null_be);
+
+    // UART real: a 300 baudios cada caso tardaría medio minuto en salir
+    uart_set_baudrate(UART_PORT_NUM, 115200);
+    uart_tx_benchmark(&uart_be);
+    uart_set_baudrate(UART_PORT_NUM, UART_BAUD_RATE);
+#endif
+
+    // Envío por plazo: con la prioridad más baja, solo actúa si la tarea dejó de escribir
+    if (!uart_tx_flusher_start(&flusher, 1, app_cpu))
+    {
+        printf("No se pudo crear la tarea de envío\n");
+        return;
+    }
+    uart_tx_flusher_add(&flusher, &stage_1);
+    uart_tx_flusher_add(&flusher, &stage_2);
+
+#ifdef LOG_BENCH_EN
+    log_mux_benchmark();
+#endif
+
+#ifdef HR_BENCH_EN
+    hr_benchmark();
+#endif
+
+#ifdef HR_SCHED_EN
+    if (!hr_sched_init(&hr))
+    {
+        printf("No se pudo iniciar hr_sched\n");
+        return;
+    }
+#endif
+
+#ifdef LOG_MUX_EN
+    // Registrar las tareas antes de crearlas
+    log_mux_init(&mux);
+    src_1 = log_mux_register(&mux, "Task 1");
+    src_2 = log_mux_register(&mux, "Task 2");
+    uart_tx_stage_init(&stage_drain, &uart_be, UART_TX_STAGE_LEN, portMAX_DELAY);
+
+    // Drenado: emite los registros confirmados con la prioridad más baja
+    if (!log_mux_start(&mux, &stage_drain, TX_MAX_DELAY_MS, 1, app_cpu))
+    {
+        printf("No se pudo crear la tarea de drenado\n");
+        return;
+    }
+#endif
+
     // Esperar un momento
     printf("\n---Demostración de Tareas FreeRTOS---\n");
 
@@ -139,10 +292,11 @@ void app_main()
         //     vTaskDelay(2000/ portTICK_PERIOD_MS);
         // }
 
-        // Eliminar tarea de baja prioridad
+        // Eliminar tarea de baja prioridad: se elimina ella misma después
+        // de enviar lo pendiente
         if(task_1 != NULL)              // nunca eliminar dos veces
         {
-            vTaskDelete(task_1);
+            stop_task_1 = true;
             task_1 = NULL;
         }
         vTaskDelay(1);
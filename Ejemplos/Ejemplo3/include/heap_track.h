@@ -0,0 +1,88 @@
+/**
+ *
+ * Resumen:
+ * Contabilidad del heap por tarea. heap_track_malloc/heap_track_free
+ * envuelven a pvPortMalloc/vPortFree y llevan, para cada tarea que reserva,
+ * bytes vivos, pico, cantidad de reservas y liberaciones y un histograma de
+ * tamaños por potencias de 2.
+ *
+ * - Cada reserva lleva un encabezado de 8 bytes con el tamaño y la tarea
+ *   dueña, así la liberación es O(1) aunque la haga otra tarea.
+ * - El camino rápido no usa secciones críticas: la entrada de la tarea se
+ *   encuentra por un puntero de almacenamiento local (TLS, índice
+ *   HEAP_TRACK_TLS_INDEX), solo la tarea dueña escribe sus contadores de
+ *   reserva y las liberaciones son sumas atómicas.
+ * - Las tareas se registran solas en la primera reserva. Con la tabla
+ *   llena se reutilizan las entradas de tareas que ya no existen y no tienen
+ *   bytes vivos; si no hay, la tarea se cuenta en la entrada compartida
+ *   "otras", que se actualiza con la sección crítica tomada.
+ * - Buscar tareas eliminadas usa uxTaskGetSystemState
+ *   (CONFIG_FREERTOS_USE_TRACE_FACILITY).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef HEAP_TRACK_H
+#define HEAP_TRACK_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define HEAP_TRACK_MAX_TASKS  (8)     // Incluye la entrada compartida "otras"
+#define HEAP_TRACK_TLS_INDEX  (1)     // El índice 0 lo usa pthread
+
+#if configNUM_THREAD_LOCAL_STORAGE_POINTERS <= HEAP_TRACK_TLS_INDEX
+#error "heap_track necesita CONFIG_FREERTOS_THREAD_LOCAL_STORAGE_POINTERS >= 2"
+#endif
+#define HEAP_TRACK_CLASSES    (10)    // <=16, 32, 64, ..., 4096, >4096 bytes
+#define HEAP_TRACK_NAME_LEN   (12)
+
+// Contadores de una tarea
+typedef struct {
+  TaskHandle_t task;                  // NULL en la entrada compartida
+  char name[HEAP_TRACK_NAME_LEN];
+  _Atomic uint32_t live_bytes;        // Bytes reservados y no liberados
+  uint32_t peak_bytes;
+  uint32_t allocs;
+  _Atomic uint32_t frees;
+  uint32_t hist[HEAP_TRACK_CLASSES];  // Reservas por clase de tamaño
+} heap_track_task_t;
+
+// Copia compacta para informar
+typedef struct {
+  char name[HEAP_TRACK_NAME_LEN];
+  uint32_t live_bytes;
+  uint32_t peak_bytes;
+  uint32_t allocs;
+  uint32_t frees;
+  uint32_t hist[HEAP_TRACK_CLASSES];
+} heap_track_snap_t;
+
+void *heap_track_malloc(size_t size);
+void heap_track_free(void *ptr);
+
+/**
+ * @brief Copiar los contadores de hasta `max` tareas
+ *
+ * @return Cantidad de tareas copiadas
+ */
+size_t heap_track_snapshot(heap_track_snap_t *out, size_t max);
+
+/**
+ * @brief Imprimir una línea por tarea con bytes vivos, pico, conteos e histograma
+ */
+void heap_track_print(void);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Medir el costo agregado por reserva y liberación frente a pvPortMalloc
+ */
+void heap_track_benchmark(void);
+
+#endif // HEAP_TRACK_H
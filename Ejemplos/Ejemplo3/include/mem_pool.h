@@ -0,0 +1,128 @@
+/**
+ *
+ * Resumen:
+ * Pool de bloques de tamaño fijo con reserva y liberación O(1) como
+ * alternativa a pvPortMalloc/vPortFree en lazos que reservan y liberan
+ * continuamente. Los bloques libres forman una lista enlazada dentro del
+ * propio almacenamiento, por lo que el heap no se fragmenta.
+ *
+ * - Apto para tareas e ISR de ambos núcleos (sección crítica corta).
+ * - Almacenamiento estático (MEM_POOL_STORAGE) o reservado una sola vez del
+ *   heap al iniciar.
+ * - Varias clases de tamaño agrupadas en un mem_pool_set_t: se usa la clase
+ *   más chica que alcance y, si está agotada, la siguiente.
+ * - Estadísticas por pool: en uso, pico, reservas fallidas y liberaciones
+ *   rechazadas.
+ * - Liberar verifica que el puntero sea un bloque del pool (rango y
+ *   alineación). Con asserts activos (sin NDEBUG, el default de ESP-IDF)
+ *   cada pool lleva además un bit por bloque en uso, reservado del heap al
+ *   iniciar, y una doble liberación se rechaza en lugar de corromper la
+ *   lista libre.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef MEM_POOL_H
+#define MEM_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
+#define MEM_POOL_ALIGN        (8)     // Alineación de cada bloque
+#define MEM_POOL_MAX_CLASSES  (6)
+
+#ifndef NDEBUG
+#define MEM_POOL_DEBUG                // Bit de bloque en uso (doble liberación)
+#endif
+
+// Tamaño de bloque redondeado a la alineación
+#define MEM_POOL_BLOCK(size)  (((size) + MEM_POOL_ALIGN - 1) & ~(size_t)(MEM_POOL_ALIGN - 1))
+
+// Declarar almacenamiento estático para `count` bloques de `size` bytes
+#define MEM_POOL_STORAGE(name, size, count) \
+  static uint8_t name[MEM_POOL_BLOCK(size) * (count)] __attribute__((aligned(MEM_POOL_ALIGN)))
+
+typedef struct {
+  const char *name;
+  uint8_t *base;              // Primer bloque
+  void *free_list;            // Bloques libres enlazados
+  size_t block_size;
+  uint32_t num_blocks;
+  uint32_t used;              // Bloques en uso
+  uint32_t peak;              // Máximo de bloques en uso
+  uint32_t failed;            // Reservas sin bloque libre
+  uint32_t bad_frees;         // Liberaciones rechazadas (puntero ajeno o bloque libre)
+#ifdef MEM_POOL_DEBUG
+  uint32_t *in_use;           // Un bit por bloque
+#endif
+  portMUX_TYPE lock;
+} mem_pool_t;
+
+// Conjunto de clases de tamaño, ordenadas de menor a mayor
+typedef struct {
+  mem_pool_t *pools[MEM_POOL_MAX_CLASSES];
+  uint32_t count;
+  uint32_t failed;            // Pedidos que no entraron en ninguna clase
+} mem_pool_set_t;
+
+/**
+ * @brief Iniciar un pool
+ *
+ * @param storage Almacenamiento de MEM_POOL_BLOCK(block_size) * num_blocks bytes
+ *                o NULL para reservarlo del heap (una sola vez)
+ * @return false si no se pudo reservar el almacenamiento (o el bitmap de
+ *         MEM_POOL_DEBUG)
+ */
+bool mem_pool_init(mem_pool_t *pool, const char *name, size_t block_size,
+                   uint32_t num_blocks, void *storage);
+
+void *mem_pool_alloc(mem_pool_t *pool);
+
+/**
+ * @brief Devolver un bloque al pool
+ *
+ * @return false si `ptr` no es un bloque del pool o ya estaba libre; el
+ *         pool no se modifica y se cuenta en bad_frees
+ */
+bool mem_pool_free(mem_pool_t *pool, void *ptr);
+
+// Verdadero si `ptr` es un bloque de este pool
+bool mem_pool_owns(const mem_pool_t *pool, const void *ptr);
+
+/**
+ * @brief Agregar una clase al conjunto (llamar en orden de tamaño creciente)
+ */
+bool mem_pool_set_add(mem_pool_set_t *set, mem_pool_t *pool);
+
+/**
+ * @brief Reservar un bloque de al menos `size` bytes
+ *
+ * @return NULL si ninguna clase que alcance tiene bloques libres
+ */
+void *mem_pool_set_alloc(mem_pool_set_t *set, size_t size);
+
+/**
+ * @brief Devolver un bloque a la clase a la que pertenece
+ *
+ * @return false si el puntero no pertenece a ninguna clase o ya estaba libre
+ */
+bool mem_pool_set_free(mem_pool_set_t *set, void *ptr);
+
+/**
+ * @brief Imprimir las estadísticas de cada clase
+ */
+void mem_pool_set_print(const mem_pool_set_t *set);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar latencia y fragmentación contra pvPortMalloc y heap_caps_malloc
+ *        con una secuencia aleatoria de reservas y liberaciones
+ */
+void mem_pool_benchmark(void);
+
+#endif // MEM_POOL_H
@@ -0,0 +1,239 @@
+/**
+ *
+ * Resumen:
+ * Implementación de la contabilidad del heap por tarea (ver heap_track.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "heap_track.h"
+
+#define HEAP_TRACK_MAGIC    (0xA7C3)
+
+// Encabezado delante de cada bloque (mantiene la alineación de 8 bytes)
+typedef struct {
+  uint32_t size;
+  uint16_t slot;
+  uint16_t magic;
+} heap_track_hdr_t;
+
+#define SHARED_SLOT         (HEAP_TRACK_MAX_TASKS - 1)
+
+// Las primeras num_tasks entradas son de una tarea; la última es "otras"
+static heap_track_task_t tasks[HEAP_TRACK_MAX_TASKS] = {
+  [SHARED_SLOT] = { .name = "otras" },
+};
+static _Atomic uint32_t num_tasks;
+static portMUX_TYPE track_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Clase de tamaño: 0 para <= 16 bytes, luego una por potencia de 2
+static inline uint32_t size_class(uint32_t size)
+{
+  if (size <= 16) {
+    return 0;
+  }
+  uint32_t c = 32 - __builtin_clz(size - 1) - 4;
+  return c < HEAP_TRACK_CLASSES ? c : HEAP_TRACK_CLASSES - 1;
+}
+
+// Entradas de tareas que ya no existen y no tienen bytes vivos (ninguna
+// liberación futura las va a tocar): se anota su tarea en dead[i], o NULL.
+// Sin memoria no se reutiliza nada.
+static uint32_t find_dead_slots(TaskHandle_t dead[HEAP_TRACK_MAX_TASKS])
+{
+  UBaseType_t count = uxTaskGetNumberOfTasks() + 2;   // Margen por tareas nuevas
+  TaskStatus_t *status = pvPortMalloc(count * sizeof(TaskStatus_t));
+  uint32_t found = 0;
+
+  if (status == NULL) {
+    return 0;
+  }
+  count = uxTaskGetSystemState(status, count, NULL);
+
+  uint32_t n = atomic_load_explicit(&num_tasks, memory_order_acquire);
+  for (uint32_t i = 0; i < n; i++) {
+    TaskHandle_t owner = tasks[i].task;
+    bool alive = (atomic_load_explicit(&tasks[i].live_bytes, memory_order_relaxed) != 0);
+    for (UBaseType_t k = 0; k < count && !alive; k++) {
+      alive = (status[k].xHandle == owner);
+    }
+    dead[i] = alive ? NULL : owner;
+    found += !alive;
+  }
+
+  vPortFree(status);
+  return found;
+}
+
+static void slot_reset(heap_track_task_t *t, TaskHandle_t self)
+{
+  t->task = self;
+  strncpy(t->name, pcTaskGetName(self), HEAP_TRACK_NAME_LEN - 1);
+  t->name[HEAP_TRACK_NAME_LEN - 1] = '\0';
+  atomic_store_explicit(&t->live_bytes, 0, memory_order_relaxed);
+  t->peak_bytes = 0;
+  t->allocs = 0;
+  atomic_store_explicit(&t->frees, 0, memory_order_relaxed);
+  memset(t->hist, 0, sizeof(t->hist));
+}
+
+// Registrar la tarea actual (camino lento, una vez por tarea)
+static heap_track_task_t *register_self(TaskHandle_t self)
+{
+  TaskHandle_t dead[HEAP_TRACK_MAX_TASKS] = { NULL };
+  heap_track_task_t *t = &tasks[SHARED_SLOT];
+
+  // La búsqueda reserva memoria: fuera de la sección crítica
+  bool full = atomic_load_explicit(&num_tasks, memory_order_acquire) >= SHARED_SLOT;
+  bool reuse = full && find_dead_slots(dead) > 0;
+
+  portENTER_CRITICAL_SAFE(&track_lock);
+  uint32_t n = atomic_load_explicit(&num_tasks, memory_order_relaxed);
+  if (n < SHARED_SLOT) {
+    t = &tasks[n];
+    slot_reset(t, self);
+    atomic_store_explicit(&num_tasks, n + 1, memory_order_release);
+  } else if (reuse) {
+    for (uint32_t i = 0; i < n; i++) {
+      // Si cambió de dueño, otra tarea la reutilizó recién
+      if (dead[i] != NULL && tasks[i].task == dead[i]) {
+        t = &tasks[i];
+        slot_reset(t, self);
+        break;
+      }
+    }
+  }
+  portEXIT_CRITICAL_SAFE(&track_lock);
+
+  // También la entrada compartida: así la búsqueda acierta en la próxima reserva
+  vTaskSetThreadLocalStoragePointer(NULL, HEAP_TRACK_TLS_INDEX, t);
+  return t;
+}
+
+// Entrada de la tarea actual; se registra en la primera reserva
+static inline heap_track_task_t *current_slot(void)
+{
+  heap_track_task_t *t = pvTaskGetThreadLocalStoragePointer(NULL, HEAP_TRACK_TLS_INDEX);
+
+  if (t == NULL) {
+    t = register_self(xTaskGetCurrentTaskHandle());
+  }
+  return t;
+}
+
+// Sumar una reserva a la entrada (solo la dueña, salvo en la compartida)
+static inline void count_alloc(heap_track_task_t *t, uint32_t size)
+{
+  uint32_t live = atomic_fetch_add_explicit(&t->live_bytes, size, memory_order_relaxed) + size;
+  if (live > t->peak_bytes) {
+    t->peak_bytes = live;
+  }
+  t->allocs++;
+  t->hist[size_class(size)]++;
+}
+
+void *heap_track_malloc(size_t size)
+{
+  heap_track_hdr_t *hdr = (heap_track_hdr_t *)pvPortMalloc(sizeof(heap_track_hdr_t) + size);
+
+  if (hdr == NULL) {
+    return NULL;
+  }
+
+  heap_track_task_t *t = current_slot();
+  hdr->size = (uint32_t)size;
+  hdr->slot = (uint16_t)(t - tasks);
+  hdr->magic = HEAP_TRACK_MAGIC;
+
+  if (t == &tasks[SHARED_SLOT]) {
+    // Varias tareas escriben la compartida
+    portENTER_CRITICAL_SAFE(&track_lock);
+    count_alloc(t, (uint32_t)size);
+    portEXIT_CRITICAL_SAFE(&track_lock);
+  } else {
+    count_alloc(t, (uint32_t)size);
+  }
+
+  return hdr + 1;
+}
+
+void heap_track_free(void *ptr)
+{
+  if (ptr == NULL) {
+    return;
+  }
+
+  heap_track_hdr_t *hdr = (heap_track_hdr_t *)ptr - 1;
+  configASSERT(hdr->magic == HEAP_TRACK_MAGIC);
+
+  heap_track_task_t *t = &tasks[hdr->slot];
+  atomic_fetch_sub_explicit(&t->live_bytes, hdr->size, memory_order_relaxed);
+  atomic_fetch_add_explicit(&t->frees, 1, memory_order_relaxed);
+
+  hdr->magic = 0;
+  vPortFree(hdr);
+}
+
+// Entradas a informar: las de una tarea y "otras" si se usó
+static uint32_t entries(uint32_t idx[HEAP_TRACK_MAX_TASKS])
+{
+  uint32_t n = atomic_load_explicit(&num_tasks, memory_order_acquire);
+
+  for (uint32_t i = 0; i < n; i++) {
+    idx[i] = i;
+  }
+  if (tasks[SHARED_SLOT].allocs > 0) {
+    idx[n++] = SHARED_SLOT;
+  }
+  return n;
+}
+
+// Copiar la entrada i (los contadores pueden seguir cambiando mientras tanto)
+static void snap_entry(uint32_t i, heap_track_snap_t *out)
+{
+  memcpy(out->name, tasks[i].name, HEAP_TRACK_NAME_LEN);
+  out->live_bytes = atomic_load_explicit(&tasks[i].live_bytes, memory_order_relaxed);
+  out->peak_bytes = tasks[i].peak_bytes;
+  out->allocs = tasks[i].allocs;
+  out->frees = atomic_load_explicit(&tasks[i].frees, memory_order_relaxed);
+  memcpy(out->hist, tasks[i].hist, sizeof(out->hist));
+}
+
+size_t heap_track_snapshot(heap_track_snap_t *out, size_t max)
+{
+  uint32_t idx[HEAP_TRACK_MAX_TASKS];
+  uint32_t n = entries(idx);
+
+  if (n > max) {
+    n = max;
+  }
+  for (uint32_t i = 0; i < n; i++) {
+    snap_entry(idx[i], &out[i]);
+  }
+  return n;
+}
+
+void heap_track_print(void)
+{
+  heap_track_snap_t snap;
+  uint32_t idx[HEAP_TRACK_MAX_TASKS];
+  uint32_t n = entries(idx);
+
+  printf("tarea       |   vivos |    pico | reservas | liberac. | <=16 32 64 128 256 512 1K 2K 4K >4K\n");
+  for (uint32_t i = 0; i < n; i++) {
+    snap_entry(idx[i], &snap);
+    printf("%-11s | %7lu | %7lu | %8lu | %8lu |",
+           snap.name, (unsigned long)snap.live_bytes, (unsigned long)snap.peak_bytes,
+           (unsigned long)snap.allocs, (unsigned long)snap.frees);
+    for (int c = 0; c < HEAP_TRACK_CLASSES; c++) {
+      printf(" %lu", (unsigned long)snap.hist[c]);
+    }
+    printf("\n");
+  }
+}
@@ -0,0 +1,58 @@
+/**
+ *
+ * Resumen:
+ * Medición del costo agregado por heap_track: pares reserva/liberación con
+ * pvPortMalloc/vPortFree directos y a través de la capa de contabilidad.
+ * Se toma la mejor de varias rondas para que el ruido del heap no tape la
+ * diferencia.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "heap_track.h"
+
+#include "bench_clock.h"
+
+// Configuración
+#define BENCH_PAIRS     (500)   // Pares reserva/liberación por ronda
+#define BENCH_ROUNDS    (5)
+#define BENCH_SIZE      (64)
+
+void heap_track_benchmark(void)
+{
+  uint32_t best_raw = UINT32_MAX;
+  uint32_t best_track = UINT32_MAX;
+
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    uint32_t t0 = bench_ticks();
+    for (int i = 0; i < BENCH_PAIRS; i++) {
+      void *p = pvPortMalloc(BENCH_SIZE);
+      vPortFree(p);
+    }
+    uint32_t raw = (bench_ticks() - t0) / BENCH_PAIRS;
+
+    t0 = bench_ticks();
+    for (int i = 0; i < BENCH_PAIRS; i++) {
+      void *p = heap_track_malloc(BENCH_SIZE);
+      heap_track_free(p);
+    }
+    uint32_t track = (bench_ticks() - t0) / BENCH_PAIRS;
+
+    if (raw < best_raw) {
+      best_raw = raw;
+    }
+    if (track < best_track) {
+      best_track = track;
+    }
+  }
+
+  printf("---Medición heap_track (%d pares de %d bytes, mejor de %d rondas)---\n",
+         BENCH_PAIRS, BENCH_SIZE, BENCH_ROUNDS);
+  printf("pvPortMalloc/vPortFree | %6lu %s/par\n", (unsigned long)best_raw, BENCH_TICK_UNIT);
+  printf("heap_track             | %6lu %s/par\n", (unsigned long)best_track, BENCH_TICK_UNIT);
+  printf("costo agregado         | %6ld %s/par\n", (long)best_track - (long)best_raw, BENCH_TICK_UNIT);
+}
@@ -2,6 +2,13 @@
  * Resumen:
  * Este código muestra cómo utilizar FreeRTOS en ESP32
  * para reservar memoria.
+ * Con MEM_POOL_EN la tarea reserva de un pool de bloques de tamaño fijo con
+ * almacenamiento estático en lugar del heap, evitando la fragmentación.
+ * Con HEAP_TRACK_EN las reservas pasan por heap_track, que lleva bytes vivos,
+ * pico, conteos e histograma de tamaños por tarea.
+ * Con STACK_PROF_EN se recorren todas las tareas (también las del sistema) y
+ * cada STACK_PROF_RUN_MS se imprime el peor caso de pila y el tamaño
+ * recomendado (componente compartido Ejemplos/components/stack_prof).
  * Documentacion: https://www.freertos.org/Documentation/02-Kernel/02-Kernel-features/09-Memory-management/01-Memory-management
  *
  * Configuración GPIO:
@@ -16,6 +23,28 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_heap_caps.h"
+#include "mem_pool.h"
+#include "heap_track.h"
+#include "stack_prof.h"
+
+// Descomentar para reservar del pool de bloques fijos en lugar del heap
+//#define MEM_POOL_EN
+
+// Descomentar para comparar el pool contra pvPortMalloc y heap_caps_malloc al iniciar
+//#define MEM_BENCH_EN
+
+// Descomentar para contabilizar el heap por tarea (agrega una segunda tarea que reserva)
+//#define HEAP_TRACK_EN
+
+// Descomentar para medir el costo agregado por heap_track al iniciar
+//#define HEAP_TRACK_BENCH_EN
+
+// Descomentar para perfilar la pila de todas las tareas y recomendar tamaños
+//#define STACK_PROF_EN
+
+// Configuración del perfilador de pila
+#define STACK_PROF_RUN_MS   (10000)     // Duración de cada ventana de la carga de trabajo
+#define STACK_PROF_MARGIN   (20)        // Margen de seguridad en % sobre el peor caso
 
 // Definir número de núcleo
 #if CONFIG_FREERTOS_UNICORE
@@ -24,9 +53,22 @@ static const BaseType_t app_cpu = 0;
 static const BaseType_t app_cpu = 1;
 #endif
 
+#ifdef MEM_POOL_EN
+// Clases de tamaño con almacenamiento estático: el lazo no toca el heap
+MEM_POOL_STORAGE(small_storage, 64, 8);
+MEM_POOL_STORAGE(large_storage, 1024 * sizeof(int), 2);
+static mem_pool_t small_pool;
+static mem_pool_t large_pool;
+static mem_pool_set_t pools;
+#endif
+
 // Tarea
 void testTask(void *parameter)
 {
+#if defined(MEM_POOL_EN) || defined(HEAP_TRACK_EN)
+    uint32_t iter = 0;
+#endif
+
     while(1)
     {
         uint16_t a = 1;
@@ -48,7 +90,13 @@ void testTask(void *parameter)
         // Funciones para reservar memoria de heap (descomentar una para seleccionar la función utilizada)
         //int *ptr = (int*) malloc(1024 * sizeof(int));     // en ESP32 se llama a heap_caps_malloc, en FreeRTOS vainilla no es thread safe
         //int *ptr = (int *) heap_caps_malloc(1024 * sizeof(int), MALLOC_CAP_DEFAULT);      // esta función se usa en ESP32
+#ifdef MEM_POOL_EN
+        int *ptr = (int *) mem_pool_set_alloc(&pools, 1024 * sizeof(int));     // bloque fijo, O(1)
+#elif defined(HEAP_TRACK_EN)
+        int *ptr = (int *) heap_track_malloc(1024 * sizeof(int));     // pvPortMalloc contabilizado
+#else
         int *ptr = (int*) pvPortMalloc(1024 * sizeof(int));      // función de FreeRTOS vainilla
+#endif
 
         // Prevenir overflow de heap corroborando que el retorno de malloc != NULL
         if(ptr == NULL)
@@ -69,12 +117,54 @@ void testTask(void *parameter)
         // Funciones para liberar memoria de heap (intentar comentar esta sección para que se quede sin heap)
         //free(ptr);                // en ESP32 se llama a heap_caps_free, en FreeRTOS vainilla no es thread safe
         //heap_caps_free(ptr);      // función de ESP32 para liberar heap
+#ifdef MEM_POOL_EN
+        mem_pool_set_free(&pools, ptr);     // vuelve a la lista libre de su clase
+
+        // Estadísticas del pool cada 5 s
+        if((++iter % 50) == 0)
+        {
+            mem_pool_set_print(&pools);
+        }
+#elif defined(HEAP_TRACK_EN)
+        heap_track_free(ptr);
+
+        // Contabilidad por tarea cada 5 s
+        if((++iter % 50) == 0)
+        {
+            heap_track_print();
+        }
+#else
         vPortFree(ptr);             // función de FreeRTOS vainilla para liberar
+#endif
 
         vTaskDelay(100 / portTICK_PERIOD_MS);
     }
 }
 
+#ifdef HEAP_TRACK_EN
+// Tarea que mantiene varias reservas chicas de tamaños distintos
+void allocTask(void *parameter)
+{
+    char *keep[4] = {NULL};
+    uint32_t n = 0;
+
+    while(1)
+    {
+        // Reemplazar una de las reservas vivas por otra de 16 a 1024 bytes
+        uint32_t k = n % 4;
+        size_t size = 16u << (n % 7);
+        heap_track_free(keep[k]);
+        keep[k] = (char *) heap_track_malloc(size);
+        if(keep[k] != NULL)
+        {
+            memset(keep[k], 0, size);
+        }
+        n++;
+        vTaskDelay(250 / portTICK_PERIOD_MS);
+    }
+}
+#endif
+
 void app_main()
 {
     // Esperar un momento
@@ -82,9 +172,35 @@ void app_main()
 
     printf("---Demostración de Memoria FreeRTOS---\n");
 
+#ifdef MEM_BENCH_EN
+    mem_pool_benchmark();
+#endif
+
+#ifdef MEM_POOL_EN
+    // Iniciar las clases de tamaño (de menor a mayor)
+    mem_pool_init(&small_pool, "64", 64, 8, small_storage);
+    mem_pool_init(&large_pool, "4096", 1024 * sizeof(int), 2, large_storage);
+    mem_pool_set_add(&pools, &small_pool);
+    mem_pool_set_add(&pools, &large_pool);
+#endif
+
+#ifdef HEAP_TRACK_BENCH_EN
+    heap_track_benchmark();
+#endif
+
+#ifdef STACK_PROF_EN
+    // Tamaño exacto de la principal; el resto se deduce de la pila de cada tarea
+    stack_prof_register(xTaskGetCurrentTaskHandle(), pcTaskGetName(NULL), CONFIG_ESP_MAIN_TASK_STACK_SIZE);
+    stack_prof_start(STACK_PROF_RUN_MS, STACK_PROF_MARGIN, 1, tskNO_AFFINITY);
+#endif
+
     // Crear tarea (tamaño de pila insuficiente, se requieren 768 para overhead, para esta tarea mínimo ~1850)
     xTaskCreatePinnedToCore(testTask, "Test Task", 2000, NULL, 1, NULL, app_cpu);
 
+#ifdef HEAP_TRACK_EN
+    xTaskCreatePinnedToCore(allocTask, "Alloc Task", 2000, NULL, 1, NULL, app_cpu);
+#endif
+
     // En FreeRTOS vainilla se debe llamar vTaskStartScheduler() en el main después de configurar las tareas.
 
     // Eliminar tarea principal
@@ -0,0 +1,190 @@
+/**
+ *
+ * Resumen:
+ * Implementación del pool de bloques de tamaño fijo (ver mem_pool.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "mem_pool.h"
+
+#ifdef MEM_POOL_DEBUG
+// Posición de un bloque en el bitmap
+static inline uint32_t block_index(const mem_pool_t *pool, const void *blk)
+{
+  return (uint32_t)(((const uint8_t *)blk - pool->base) / pool->block_size);
+}
+#endif
+
+bool mem_pool_init(mem_pool_t *pool, const char *name, size_t block_size,
+                   uint32_t num_blocks, void *storage)
+{
+  // El bloque libre guarda el puntero al siguiente
+  if (block_size < sizeof(void *)) {
+    block_size = sizeof(void *);
+  }
+  block_size = MEM_POOL_BLOCK(block_size);
+
+#ifdef MEM_POOL_DEBUG
+  // Todos los bloques comienzan libres (bits en 0)
+  pool->in_use = heap_caps_calloc((num_blocks + 31) / 32, sizeof(uint32_t), MALLOC_CAP_DEFAULT);
+  if (pool->in_use == NULL) {
+    return false;
+  }
+#endif
+
+  if (storage == NULL) {
+    storage = heap_caps_malloc(block_size * num_blocks, MALLOC_CAP_DEFAULT);
+    if (storage == NULL) {
+#ifdef MEM_POOL_DEBUG
+      heap_caps_free(pool->in_use);
+#endif
+      return false;
+    }
+  }
+
+  pool->name = name;
+  pool->base = (uint8_t *)storage;
+  pool->block_size = block_size;
+  pool->num_blocks = num_blocks;
+  pool->used = 0;
+  pool->peak = 0;
+  pool->failed = 0;
+  pool->bad_frees = 0;
+  portMUX_INITIALIZE(&pool->lock);
+
+  // Enlazar todos los bloques en orden
+  pool->free_list = NULL;
+  for (uint32_t i = num_blocks; i > 0; i--) {
+    void **blk = (void **)(pool->base + (i - 1) * block_size);
+    *blk = pool->free_list;
+    pool->free_list = blk;
+  }
+
+  return true;
+}
+
+void *mem_pool_alloc(mem_pool_t *pool)
+{
+  void **blk;
+
+  portENTER_CRITICAL_SAFE(&pool->lock);
+  blk = (void **)pool->free_list;
+  if (blk != NULL) {
+    pool->free_list = *blk;
+    if (++pool->used > pool->peak) {
+      pool->peak = pool->used;
+    }
+#ifdef MEM_POOL_DEBUG
+    uint32_t idx = block_index(pool, blk);
+    pool->in_use[idx / 32] |= 1u << (idx % 32);
+#endif
+  } else {
+    pool->failed++;
+  }
+  portEXIT_CRITICAL_SAFE(&pool->lock);
+
+  return blk;
+}
+
+bool mem_pool_free(mem_pool_t *pool, void *ptr)
+{
+  if (ptr == NULL) {
+    return true;
+  }
+
+  // Un puntero ajeno o desalineado corrompería la lista libre; sin el
+  // bitmap al menos `used` no da la vuelta
+  bool ok = mem_pool_owns(pool, ptr);
+
+  portENTER_CRITICAL_SAFE(&pool->lock);
+  ok = ok && pool->used > 0;
+#ifdef MEM_POOL_DEBUG
+  if (ok) {
+    uint32_t idx = block_index(pool, ptr);
+    uint32_t bit = 1u << (idx % 32);
+
+    ok = (pool->in_use[idx / 32] & bit) != 0;
+    pool->in_use[idx / 32] &= ~bit;
+  }
+#endif
+  if (ok) {
+    *(void **)ptr = pool->free_list;
+    pool->free_list = ptr;
+    pool->used--;
+  } else {
+    pool->bad_frees++;
+  }
+  portEXIT_CRITICAL_SAFE(&pool->lock);
+
+  return ok;
+}
+
+bool mem_pool_owns(const mem_pool_t *pool, const void *ptr)
+{
+  const uint8_t *p = (const uint8_t *)ptr;
+
+  if (p < pool->base || p >= pool->base + pool->block_size * pool->num_blocks) {
+    return false;
+  }
+  return ((size_t)(p - pool->base) % pool->block_size) == 0;
+}
+
+bool mem_pool_set_add(mem_pool_set_t *set, mem_pool_t *pool)
+{
+  if (set->count >= MEM_POOL_MAX_CLASSES) {
+    return false;
+  }
+  set->pools[set->count++] = pool;
+  return true;
+}
+
+void *mem_pool_set_alloc(mem_pool_set_t *set, size_t size)
+{
+  for (uint32_t i = 0; i < set->count; i++) {
+    mem_pool_t *pool = set->pools[i];
+
+    // Si la clase justa está agotada se prueba con la siguiente
+    if (pool->block_size >= size) {
+      void *ptr = mem_pool_alloc(pool);
+      if (ptr != NULL) {
+        return ptr;
+      }
+    }
+  }
+
+  set->failed++;
+  return NULL;
+}
+
+bool mem_pool_set_free(mem_pool_set_t *set, void *ptr)
+{
+  if (ptr == NULL) {
+    return true;
+  }
+
+  for (uint32_t i = 0; i < set->count; i++) {
+    if (mem_pool_owns(set->pools[i], ptr)) {
+      return mem_pool_free(set->pools[i], ptr);
+    }
+  }
+  return false;
+}
+
+void mem_pool_set_print(const mem_pool_set_t *set)
+{
+  printf("pool      | bloque | total | en uso | pico | fallidas | rechazadas\n");
+  for (uint32_t i = 0; i < set->count; i++) {
+    const mem_pool_t *p = set->pools[i];
+    printf("%-9s | %6u | %5lu | %6lu | %4lu | %8lu | %10lu\n",
+           p->name, (unsigned)p->block_size, (unsigned long)p->num_blocks,
+           (unsigned long)p->used, (unsigned long)p->peak, (unsigned long)p->failed,
+           (unsigned long)p->bad_frees);
+  }
+  printf("sin clase disponible: %lu\n", (unsigned long)set->failed);
+}
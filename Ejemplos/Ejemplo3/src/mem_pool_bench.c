@@ -0,0 +1,176 @@
+/**
+ *
+ * Resumen:
+ * Medición del pool de bloques contra pvPortMalloc y heap_caps_malloc con la
+ * misma secuencia pseudoaleatoria de reservas y liberaciones (semilla fija):
+ * latencia media y máxima por operación, reservas fallidas y fragmentación.
+ *
+ * - Heap: fragmentación externa = 1 - bloque libre más grande / libre total,
+ *   tomando el peor valor durante la secuencia.
+ * - Pool: no hay fragmentación externa; se informa el desperdicio interno
+ *   (bytes del bloque que el pedido no usa).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "mem_pool.h"
+
+#include "bench_clock.h"
+
+// Configuración
+#define BENCH_OPS         (4000)    // Operaciones de la secuencia
+#define BENCH_LIVE        (24)      // Reservas vivas como máximo
+#define BENCH_SEED        (12345u)
+#define BENCH_FRAG_EVERY  (256)     // Cada cuántas operaciones se mide la fragmentación
+
+// Interfaz común para los tres métodos
+typedef struct {
+  const char *name;
+  void *(*alloc)(size_t size);
+  void (*free)(void *ptr);
+  bool heap;                        // Medir fragmentación del heap
+} bench_alloc_t;
+
+static mem_pool_set_t bench_set;
+
+static void *pool_alloc(size_t size)      { return mem_pool_set_alloc(&bench_set, size); }
+static void pool_free(void *ptr)          { mem_pool_set_free(&bench_set, ptr); }
+static void *port_alloc(size_t size)      { return pvPortMalloc(size); }
+static void port_free(void *ptr)          { vPortFree(ptr); }
+static void *caps_alloc(size_t size)      { return heap_caps_malloc(size, MALLOC_CAP_DEFAULT); }
+static void caps_free(void *ptr)          { heap_caps_free(ptr); }
+
+// Generador congruencial: misma secuencia para todos los métodos
+static uint32_t lcg_next(uint32_t *state)
+{
+  *state = *state * 1664525u + 1013904223u;
+  return *state >> 8;
+}
+
+// Tamaño con mayoría de pedidos chicos: 50% <= 32, 30% <= 128, 20% <= 512
+static size_t trace_size(uint32_t r)
+{
+  uint32_t k = r % 10;
+
+  if (k < 5) {
+    return 8 + (r >> 4) % 25;
+  } else if (k < 8) {
+    return 33 + (r >> 4) % 96;
+  }
+  return 129 + (r >> 4) % 384;
+}
+
+static float heap_frag(void)
+{
+  size_t free_bytes = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+  size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT);
+
+  return free_bytes ? 100.0f * (1.0f - (float)largest / free_bytes) : 0.0f;
+}
+
+static void bench_run(const bench_alloc_t *a)
+{
+  void *live[BENCH_LIVE] = {0};
+  size_t live_size[BENCH_LIVE] = {0};
+  uint32_t seed = BENCH_SEED;
+  uint32_t ops = 0, max = 0, failed = 0;
+  uint64_t sum = 0;
+  uint64_t asked = 0, given = 0;
+  float frag = 0.0f;
+
+  for (int i = 0; i < BENCH_OPS; i++) {
+    uint32_t r = lcg_next(&seed);
+    int slot = r % BENCH_LIVE;
+    uint32_t t0, dt;
+
+    if (live[slot] != NULL) {
+      t0 = bench_ticks();
+      a->free(live[slot]);
+      dt = bench_ticks() - t0;
+      live[slot] = NULL;
+    } else {
+      size_t size = trace_size(lcg_next(&seed));
+      t0 = bench_ticks();
+      live[slot] = a->alloc(size);
+      dt = bench_ticks() - t0;
+      if (live[slot] == NULL) {
+        failed++;
+      } else {
+        live_size[slot] = size;
+      }
+    }
+
+    ops++;
+    sum += dt;
+    if (dt > max) {
+      max = dt;
+    }
+
+    // Fragmentación (fuera de la medición de tiempo)
+    if (a->heap && (i % BENCH_FRAG_EVERY) == BENCH_FRAG_EVERY - 1) {
+      float f = heap_frag();
+      if (f > frag) {
+        frag = f;
+      }
+    }
+  }
+
+  // Desperdicio interno del pool: tamaño del bloque entregado contra el pedido
+  if (!a->heap) {
+    for (int s = 0; s < BENCH_LIVE; s++) {
+      for (uint32_t c = 0; live[s] != NULL && c < bench_set.count; c++) {
+        if (mem_pool_owns(bench_set.pools[c], live[s])) {
+          asked += live_size[s];
+          given += bench_set.pools[c]->block_size;
+        }
+      }
+    }
+    frag = given ? 100.0f * (1.0f - (float)asked / given) : 0.0f;
+  }
+
+  printf("%-16s | media: %7.1f %s | max: %7lu %s | fallidas: %4lu | %s: %5.1f%%\n",
+         a->name, (double)sum / ops, BENCH_TICK_UNIT, (unsigned long)max, BENCH_TICK_UNIT,
+         (unsigned long)failed, a->heap ? "frag. externa" : "desp. interno", frag);
+
+  for (int s = 0; s < BENCH_LIVE; s++) {
+    a->free(live[s]);
+  }
+}
+
+void mem_pool_benchmark(void)
+{
+  static mem_pool_t p32, p128, p512;
+  static const bench_alloc_t methods[] = {
+    { "mem_pool",         pool_alloc, pool_free, false },
+    { "pvPortMalloc",     port_alloc, port_free, true  },
+    { "heap_caps_malloc", caps_alloc, caps_free, true  },
+  };
+
+  // Almacenamiento del pool reservado una sola vez para toda la medición
+  memset(&bench_set, 0, sizeof(bench_set));
+  if (!mem_pool_init(&p32, "32", 32, BENCH_LIVE, NULL) ||
+      !mem_pool_init(&p128, "128", 128, BENCH_LIVE, NULL) ||
+      !mem_pool_init(&p512, "512", 512, BENCH_LIVE, NULL)) {
+    printf("No hay suficiente heap para la medición.\n");
+    return;
+  }
+  mem_pool_set_add(&bench_set, &p32);
+  mem_pool_set_add(&bench_set, &p128);
+  mem_pool_set_add(&bench_set, &p512);
+
+  printf("---Medición mem_pool (%d operaciones, %d reservas vivas)---\n", BENCH_OPS, BENCH_LIVE);
+  for (size_t i = 0; i < sizeof(methods) / sizeof(methods[0]); i++) {
+    bench_run(&methods[i]);
+  }
+  mem_pool_set_print(&bench_set);
+
+  heap_caps_free(p32.base);
+  heap_caps_free(p128.base);
+  heap_caps_free(p512.base);
+}
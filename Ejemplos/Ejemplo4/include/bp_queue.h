@@ -0,0 +1,117 @@
+/**
+ *
+ * Resumen:
+ * Envoltorio de una cola de FreeRTOS con política de contrapresión
+ * seleccionable para cuando la cola está llena, en lugar de perder el
+ * elemento en silencio:
+ *
+ * - BP_BLOCK:       esperar hasta block_ticks; si vence, se descarta el nuevo.
+ * - BP_DROP_NEWEST: no esperar; se descarta el nuevo.
+ * - BP_DROP_OLDEST: se saca el más viejo de la cola para hacer lugar.
+ * - BP_COALESCE:    el nuevo queda pendiente fuera de la cola; los siguientes
+ *                   se fusionan con él (por defecto gana la última muestra) y
+ *                   se entrega apenas hay lugar, antes del siguiente elemento.
+ *
+ * Cada política cuenta lo enviado y lo descartado, guarda la mayor espera
+ * del productor y llama a una función del usuario por cada descarte. Los
+ * contadores admiten varios productores; BP_COALESCE supone uno solo.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef BP_QUEUE_H
+#define BP_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+#define BP_QUEUE_MAX_ITEM   (64)    // Tamaño máximo de elemento (copia local al descartar)
+
+typedef enum {
+  BP_BLOCK,
+  BP_DROP_NEWEST,
+  BP_DROP_OLDEST,
+  BP_COALESCE,
+} bp_policy_t;
+
+// Motivo de cada llamada a la función de descarte
+typedef enum {
+  BP_REASON_TIMEOUT,            // BP_BLOCK: venció la espera, se descartó el nuevo
+  BP_REASON_NEWEST,             // BP_DROP_NEWEST: se descartó el nuevo
+  BP_REASON_OLDEST,             // BP_DROP_OLDEST: se sacó el más viejo de la cola
+  BP_REASON_COALESCED,          // BP_COALESCE: el nuevo se fusionó con el pendiente
+} bp_reason_t;
+
+// `item` es el elemento descartado (o el que se fusionó)
+typedef void (*bp_drop_cb_t)(const void *item, bp_reason_t reason, void *ctx);
+
+// Fusionar `item` dentro de `pending`
+typedef void (*bp_merge_fn_t)(void *pending, const void *item, void *ctx);
+
+typedef struct {
+  uint32_t sent;                // Elementos que entraron a la cola
+  uint32_t timeouts;
+  uint32_t dropped_newest;
+  uint32_t dropped_oldest;
+  uint32_t coalesced;
+  uint32_t max_wait_us;         // Mayor tiempo dentro de bp_queue_send
+} bp_queue_stats_t;
+
+typedef struct {
+  QueueHandle_t queue;
+  bp_policy_t policy;
+  uint32_t item_size;
+  TickType_t block_ticks;
+  bp_drop_cb_t on_drop;
+  bp_merge_fn_t merge;          // NULL: quedarse con la última muestra
+  void *ctx;
+  bool has_pending;
+  uint8_t pending[BP_QUEUE_MAX_ITEM];
+  bp_queue_stats_t stats;
+  portMUX_TYPE lock;
+} bp_queue_t;
+
+/**
+ * @brief Iniciar el envoltorio de una cola ya creada
+ *
+ * @param block_ticks Espera máxima con BP_BLOCK
+ * @return false si el elemento supera BP_QUEUE_MAX_ITEM
+ */
+bool bp_queue_init(bp_queue_t *bq, QueueHandle_t queue, uint32_t item_size,
+                   bp_policy_t policy, TickType_t block_ticks);
+
+/**
+ * @brief Función a llamar por cada descarte y su contexto (también se pasa a merge)
+ */
+void bp_queue_set_drop_cb(bp_queue_t *bq, bp_drop_cb_t cb, void *ctx);
+
+/**
+ * @brief Función de fusión para BP_COALESCE (por ejemplo sumar o quedarse con el máximo)
+ */
+void bp_queue_set_merge(bp_queue_t *bq, bp_merge_fn_t merge);
+
+/**
+ * @brief Enviar según la política
+ *
+ * @return true si el elemento entró a la cola o quedó pendiente/fusionado;
+ *         false si se descartó
+ */
+bool bp_queue_send(bp_queue_t *bq, const void *item);
+
+/**
+ * @brief BP_COALESCE: intentar entregar el pendiente (por ejemplo cuando el
+ *        productor no tiene nada nuevo)
+ *
+ * @return true si no queda nada pendiente
+ */
+bool bp_queue_flush(bp_queue_t *bq);
+
+/**
+ * @brief Copiar los contadores
+ */
+void bp_queue_get_stats(bp_queue_t *bq, bp_queue_stats_t *out);
+
+#endif // BP_QUEUE_H
@@ -0,0 +1,117 @@
+/**
+ *
+ * Resumen:
+ * Canal anillo lock-free de un productor y un consumidor (SPSC) como
+ * alternativa de alto rendimiento a una cola de FreeRTOS para flujos de
+ * datos entre dos tareas fijas.
+ *
+ * - Enviar y recibir no entran en secciones críticas: cada índice lo escribe
+ *   una sola tarea y se publica con store-release.
+ * - Los índices de productor y consumidor van en líneas de caché distintas y
+ *   cada lado guarda una copia del índice del otro para no leerlo en cada
+ *   elemento.
+ * - push_n/pop_n copian bloques de elementos en una sola operación.
+ * - Solo se bloquea cuando el anillo está lleno (productor) o vacío
+ *   (consumidor), esperando una notificación de tarea del otro lado. El
+ *   canal usa la notificación directa (índice 0) de las dos tareas.
+ * - La capacidad es una potencia de 2 y el tamaño del elemento se fija al
+ *   iniciar; SPSC_CHAN_TYPED genera funciones con tipo para un elemento.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef SPSC_CHAN_H
+#define SPSC_CHAN_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define SPSC_CACHE_LINE     (32)    // Línea de caché del ESP32 (memoria externa)
+
+typedef struct {
+  // Lado productor
+  _Atomic uint32_t head __attribute__((aligned(SPSC_CACHE_LINE)));
+  uint32_t tail_cache;                  // Última cola vista por el productor
+  _Atomic(TaskHandle_t) producer;       // Tarea esperando lugar (NULL si no espera)
+
+  // Lado consumidor
+  _Atomic uint32_t tail __attribute__((aligned(SPSC_CACHE_LINE)));
+  uint32_t head_cache;                  // Última cabeza vista por el consumidor
+  _Atomic(TaskHandle_t) consumer;       // Tarea esperando datos (NULL si no espera)
+
+  // Constantes
+  uint8_t *buf __attribute__((aligned(SPSC_CACHE_LINE)));
+  uint32_t mask;
+  uint32_t item_size;
+} spsc_chan_t;
+
+/**
+ * @brief Iniciar un canal
+ *
+ * @param buf Almacenamiento de capacity * item_size bytes
+ * @param capacity Cantidad de elementos (potencia de 2)
+ * @return false si la capacidad no es potencia de 2
+ */
+bool spsc_chan_init(spsc_chan_t *ch, void *buf, uint32_t capacity, uint32_t item_size);
+
+/**
+ * @brief Enviar hasta `n` elementos (solo el productor)
+ *
+ * Copia los que entran y, mientras falten, espera hasta `timeout` a que el
+ * consumidor libere lugar. Solo se bloquea con el anillo lleno.
+ *
+ * @return Elementos enviados (menos de `n` si venció el tiempo)
+ */
+size_t spsc_chan_push_n(spsc_chan_t *ch, const void *items, size_t n, TickType_t timeout);
+
+/**
+ * @brief Recibir hasta `n` elementos (solo el consumidor)
+ *
+ * Copia los disponibles sin esperar a completar `n`; solo si el anillo está
+ * vacío espera hasta `timeout` a que llegue al menos uno.
+ *
+ * @return Elementos recibidos (0 si venció el tiempo)
+ */
+size_t spsc_chan_pop_n(spsc_chan_t *ch, void *items, size_t n, TickType_t timeout);
+
+static inline bool spsc_chan_push(spsc_chan_t *ch, const void *item, TickType_t timeout)
+{
+  return spsc_chan_push_n(ch, item, 1, timeout) == 1;
+}
+
+static inline bool spsc_chan_pop(spsc_chan_t *ch, void *item, TickType_t timeout)
+{
+  return spsc_chan_pop_n(ch, item, 1, timeout) == 1;
+}
+
+// Elementos en el anillo (aproximado si el otro lado está operando)
+uint32_t spsc_chan_count(spsc_chan_t *ch);
+
+// Funciones con tipo: SPSC_CHAN_TYPED(int_chan, int) genera int_chan_push(ch, &v, t), etc.
+#define SPSC_CHAN_TYPED(prefix, type) \
+  static inline bool prefix##_init(spsc_chan_t *ch, type *buf, uint32_t capacity) \
+  { return spsc_chan_init(ch, buf, capacity, sizeof(type)); } \
+  static inline bool prefix##_push(spsc_chan_t *ch, const type *item, TickType_t timeout) \
+  { return spsc_chan_push(ch, item, timeout); } \
+  static inline bool prefix##_pop(spsc_chan_t *ch, type *item, TickType_t timeout) \
+  { return spsc_chan_pop(ch, item, timeout); } \
+  static inline size_t prefix##_push_n(spsc_chan_t *ch, const type *items, size_t n, TickType_t timeout) \
+  { return spsc_chan_push_n(ch, items, n, timeout); } \
+  static inline size_t prefix##_pop_n(spsc_chan_t *ch, type *items, size_t n, TickType_t timeout) \
+  { return spsc_chan_pop_n(ch, items, n, timeout); }
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar elementos por segundo y latencia contra xQueueSend/xQueueReceive
+ *        para varios tamaños de elemento y profundidades
+ */
+void spsc_chan_benchmark(void);
+
+#endif // SPSC_CHAN_H
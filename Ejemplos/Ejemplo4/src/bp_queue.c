@@ -0,0 +1,159 @@
+/**
+ *
+ * Resumen:
+ * Implementación de la cola con contrapresión (ver bp_queue.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <string.h>
+#include "esp_timer.h"
+#include "bp_queue.h"
+
+// Intentos de BP_DROP_OLDEST (el consumidor puede vaciar la cola entre medio)
+#define BP_OLDEST_TRIES     (4)
+
+bool bp_queue_init(bp_queue_t *bq, QueueHandle_t queue, uint32_t item_size,
+                   bp_policy_t policy, TickType_t block_ticks)
+{
+  if (item_size > BP_QUEUE_MAX_ITEM) {
+    return false;
+  }
+
+  memset(bq, 0, sizeof(*bq));
+  bq->queue = queue;
+  bq->item_size = item_size;
+  bq->policy = policy;
+  bq->block_ticks = block_ticks;
+  portMUX_INITIALIZE(&bq->lock);
+
+  return true;
+}
+
+void bp_queue_set_drop_cb(bp_queue_t *bq, bp_drop_cb_t cb, void *ctx)
+{
+  bq->on_drop = cb;
+  bq->ctx = ctx;
+}
+
+void bp_queue_set_merge(bp_queue_t *bq, bp_merge_fn_t merge)
+{
+  bq->merge = merge;
+}
+
+// Contar un evento y avisar fuera de la sección crítica
+static void count_drop(bp_queue_t *bq, uint32_t *counter, const void *item, bp_reason_t reason)
+{
+  portENTER_CRITICAL(&bq->lock);
+  (*counter)++;
+  portEXIT_CRITICAL(&bq->lock);
+
+  if (bq->on_drop != NULL) {
+    bq->on_drop(item, reason, bq->ctx);
+  }
+}
+
+static bool try_send(bp_queue_t *bq, const void *item, TickType_t ticks)
+{
+  if (xQueueSend(bq->queue, item, ticks) != pdTRUE) {
+    return false;
+  }
+
+  portENTER_CRITICAL(&bq->lock);
+  bq->stats.sent++;
+  portEXIT_CRITICAL(&bq->lock);
+  return true;
+}
+
+bool bp_queue_flush(bp_queue_t *bq)
+{
+  if (bq->has_pending && try_send(bq, bq->pending, 0)) {
+    bq->has_pending = false;
+  }
+  return !bq->has_pending;
+}
+
+static bool send_coalesce(bp_queue_t *bq, const void *item)
+{
+  // El pendiente va antes que el nuevo para no cambiar el orden
+  if (bp_queue_flush(bq) && try_send(bq, item, 0)) {
+    return true;
+  }
+
+  if (!bq->has_pending) {
+    memcpy(bq->pending, item, bq->item_size);
+    bq->has_pending = true;
+    return true;
+  }
+
+  if (bq->merge != NULL) {
+    bq->merge(bq->pending, item, bq->ctx);
+  } else {
+    memcpy(bq->pending, item, bq->item_size);
+  }
+  count_drop(bq, &bq->stats.coalesced, item, BP_REASON_COALESCED);
+  return true;
+}
+
+static bool send_drop_oldest(bp_queue_t *bq, const void *item)
+{
+  uint8_t oldest[BP_QUEUE_MAX_ITEM];
+
+  for (int i = 0; i < BP_OLDEST_TRIES; i++) {
+    if (try_send(bq, item, 0)) {
+      return true;
+    }
+    if (xQueueReceive(bq->queue, oldest, 0) == pdTRUE) {
+      count_drop(bq, &bq->stats.dropped_oldest, oldest, BP_REASON_OLDEST);
+    }
+  }
+
+  // Otro productor ocupó el lugar cada vez: descartar el nuevo
+  count_drop(bq, &bq->stats.dropped_newest, item, BP_REASON_NEWEST);
+  return false;
+}
+
+bool bp_queue_send(bp_queue_t *bq, const void *item)
+{
+  int64_t t0 = esp_timer_get_time();
+  bool ok;
+
+  switch (bq->policy) {
+    case BP_BLOCK:
+      ok = try_send(bq, item, bq->block_ticks);
+      if (!ok) {
+        count_drop(bq, &bq->stats.timeouts, item, BP_REASON_TIMEOUT);
+      }
+      break;
+    case BP_DROP_OLDEST:
+      ok = send_drop_oldest(bq, item);
+      break;
+    case BP_COALESCE:
+      ok = send_coalesce(bq, item);
+      break;
+    case BP_DROP_NEWEST:
+    default:
+      ok = try_send(bq, item, 0);
+      if (!ok) {
+        count_drop(bq, &bq->stats.dropped_newest, item, BP_REASON_NEWEST);
+      }
+      break;
+  }
+
+  uint32_t wait_us = (uint32_t)(esp_timer_get_time() - t0);
+  portENTER_CRITICAL(&bq->lock);
+  if (wait_us > bq->stats.max_wait_us) {
+    bq->stats.max_wait_us = wait_us;
+  }
+  portEXIT_CRITICAL(&bq->lock);
+
+  return ok;
+}
+
+void bp_queue_get_stats(bp_queue_t *bq, bp_queue_stats_t *out)
+{
+  portENTER_CRITICAL(&bq->lock);
+  *out = bq->stats;
+  portEXIT_CRITICAL(&bq->lock);
+}
@@ -1,6 +1,8 @@
 /*
  * Resumen:
  * Este código muestra cómo usar FreeRTOS con una demostración de colas.
+ * Con TELEMETRY_EN printMsg envía los elementos en tramas binarias
+ * (components/telemetry) en lugar de un printf por elemento.
  * Documentación: https://www.freertos.org/Documentation/02-Kernel/02-Kernel-features/02-Queues-mutexes-and-semaphores/01-Queues
  * 
  *
@@ -17,6 +19,11 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "spsc_chan.h"
+#include "bp_queue.h"
+#include "stack_prof.h"
+#include "telemetry.h"
+#include "esp_timer.h"
 
 // Definir el número de núcleo a utilizar
 #if CONFIG_FREERTOS_UNICORE
@@ -27,26 +34,95 @@ static const BaseType_t app_cpu = 1;
 
 // Configuraciones
 #define MSG_QUEUE_LEN 5
+#define SPSC_LEN 8              // Potencia de 2
+
+//#define SPSC_EN               // Usar el canal SPSC en lugar de la cola
+//#define SPSC_BENCH_EN         // Comparar el canal SPSC con xQueue antes de la demo
+//#define BP_QUEUE_EN           // Aplicar BP_POLICY cuando la cola está llena
+#define BP_POLICY BP_DROP_OLDEST  // BP_BLOCK, BP_DROP_NEWEST, BP_DROP_OLDEST o BP_COALESCE
+//#define STACK_PROF_EN         // Informar periódicamente el peor caso de pila de todas las tareas
+//#define TELEMETRY_EN          // Enviar los elementos en tramas binarias en lugar de printf
+
+#if defined(SPSC_EN) && defined(BP_QUEUE_EN)
+#error "BP_QUEUE_EN envuelve la cola de FreeRTOS, no se puede usar con SPSC_EN"
+#endif
 
 // Global
+#ifdef SPSC_EN
+SPSC_CHAN_TYPED(int_chan, int)
+static spsc_chan_t msg_chan;
+static int msg_chan_buf[SPSC_LEN];
+#else
 static QueueHandle_t msg_queue;
+#endif
+#ifdef BP_QUEUE_EN
+static bp_queue_t msg_bp;
+#endif
+#ifdef TELEMETRY_EN
+static telem_enc_t msg_enc;
+static int16_t msg_batch[TELEM_MAX_SAMPLES];
+static uint8_t msg_frame[TELEM_MAX_FRAME];
+#endif
 
 //------------------------------------------------------
 // Tareas
 
+#ifdef BP_QUEUE_EN
+// Informar cada elemento descartado por la política
+static void onDrop(const void *item, bp_reason_t reason, void *ctx)
+{
+    static const char *const reason_txt[] = { "espera vencida", "nuevo", "más viejo", "fusionado" };
+
+    printf("Descartado: %d (%s)\n", *(const int *)item, reason_txt[reason]);
+}
+#endif
+
 // Tarea1
 void printMsg(void *parameters)
 {
     int item;
+#ifdef TELEMETRY_EN
+    telem_enc_init(&msg_enc, 0, TELEM_FMT_I16);
+#endif
     
     // Bucle infinito
-    mientras(1)
+    while(1)
     {
+#ifdef TELEMETRY_EN
+        // Todo lo que haya en la cola sale en una sola trama (los valores se
+        // truncan a 16 bits). La marca de tiempo es el instante de LECTURA, no
+        // el de envío: los elementos no llevan su marca y pueden haber esperado
+        // hasta un ciclo de esta tarea en la cola. Por eso el período de la
+        // trama es 0: todos los elementos comparten esa misma marca.
+        size_t n = 0;
+        int64_t t_read = esp_timer_get_time();
+
+        while(n < TELEM_MAX_SAMPLES &&
+#ifdef SPSC_EN
+              int_chan_pop(&msg_chan, &item, 0))
+#else
+              xQueueReceive(msg_queue, (void*)&item, 0) == pdTRUE)
+#endif
+        {
+            msg_batch[n++] = (int16_t)item;
+        }
+        if(n > 0)
+        {
+            size_t len = telem_encode(&msg_enc, (uint64_t)t_read, 0, msg_batch, n, msg_frame);
+            fwrite(msg_frame, 1, len, stdout);
+            fflush(stdout);
+        }
+#else
         // Ver si hay un mensaje en la cola (no bloquear)
+#ifdef SPSC_EN
+        if(int_chan_pop(&msg_chan, &item, 0))
+#else
         if(xQueueReceive(msg_queue, (void*)&item, 0) == pdTRUE)
+#endif
         {
             printf("%d\n", item);
         }
+#endif
         // Esperar antes de intentarlo de nuevo
         vTaskDelay(1000/portTICK_PERIOD_MS);
     }
@@ -55,17 +131,40 @@ void printMsg(void *parameters)
 // main
 void app_main() 
 {
+#ifdef STACK_PROF_EN
+    // Informe de pila de todas las tareas, también las del sistema (IDLE, Tmr Svc, esp_timer)
+    stack_prof_start(STACK_PROF_DEFAULT_PERIOD_MS, STACK_PROF_DEFAULT_MARGIN, 1, tskNO_AFFINITY);
+#endif
+
     // Esperar un momento
     vTaskDelay(1000/portTICK_PERIOD_MS);
 
+#ifdef SPSC_BENCH_EN
+    spsc_chan_benchmark();
+#endif
+
     printf("-----Demostración de Cola FreeRTOS-----\n");
 
+#ifdef SPSC_EN
+    // Crear canal (no usa el heap)
+    if(!int_chan_init(&msg_chan, msg_chan_buf, SPSC_LEN))
+    {
+        printf("ERROR: largo del canal no es potencia de 2\n");
+    }
+#else
     // Crear cola
     msg_queue = xQueueCreate(MSG_QUEUE_LEN, sizeof(int));
     if(msg_queue == NULL)
     {
         printf("ERROR: handle de cola NULL\n");
     }
+#endif
+
+#ifdef BP_QUEUE_EN
+    // Envolver la cola: con BP_BLOCK se espera hasta 10 ticks
+    bp_queue_init(&msg_bp, msg_queue, sizeof(int), BP_POLICY, 10);
+    bp_queue_set_drop_cb(&msg_bp, onDrop, NULL);
+#endif
 
     // Iniciar tarea de impresión
     xTaskCreatePinnedToCore(printMsg, "Print Msg", 1800, NULL, 1, NULL, app_cpu);
@@ -75,11 +174,31 @@ void app_main()
         static int num = 0;
 
         // Intentar agregar elemento a la cola durante 10 ticks, falla si la cola está llena.
+#ifdef SPSC_EN
+        if(!int_chan_push(&msg_chan, &num, 10))
+#elif defined(BP_QUEUE_EN)
+        if(!bp_queue_send(&msg_bp, &num))
+#else
         if(xQueueSend(msg_queue, (void*)&num, 10) != pdTRUE)
+#endif
         {
             printf("ERROR: Cola llena\n");
         }
         num++;
+
+#ifdef BP_QUEUE_EN
+        // Cada 10 elementos mostrar cuánto se descartó
+        if(num % 10 == 0)
+        {
+            bp_queue_stats_t st;
+
+            bp_queue_get_stats(&msg_bp, &st);
+            printf("enviados: %lu | vencidos: %lu | nuevos: %lu | viejos: %lu | fusionados: %lu | espera máx: %lu us\n",
+                   (unsigned long)st.sent, (unsigned long)st.timeouts,
+                   (unsigned long)st.dropped_newest, (unsigned long)st.dropped_oldest,
+                   (unsigned long)st.coalesced, (unsigned long)st.max_wait_us);
+        }
+#endif
         
         // Jugar con el tiempo para llenar completamente la cola
         vTaskDelay(1000/portTICK_PERIOD_MS);
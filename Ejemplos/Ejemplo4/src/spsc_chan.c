@@ -0,0 +1,171 @@
+/**
+ *
+ * Resumen:
+ * Implementación del canal SPSC (ver spsc_chan.h).
+ *
+ * Protocolo de espera: el lado que se va a bloquear publica su handle y
+ * vuelve a mirar el índice del otro lado; el otro lado publica su índice y
+ * después mira si hay alguien esperando. Las barreras seq_cst entre la
+ * escritura y la lectura de cada lado garantizan que al menos uno de los dos
+ * vea al otro, así no se pierde un despertar. Una notificación de más solo
+ * produce una vuelta extra del bucle.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <string.h>
+#include "spsc_chan.h"
+
+bool spsc_chan_init(spsc_chan_t *ch, void *buf, uint32_t capacity, uint32_t item_size)
+{
+  if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+    return false;
+  }
+
+  memset(ch, 0, sizeof(*ch));
+  ch->buf = (uint8_t *)buf;
+  ch->mask = capacity - 1;
+  ch->item_size = item_size;
+  atomic_init(&ch->head, 0);
+  atomic_init(&ch->tail, 0);
+  atomic_init(&ch->producer, NULL);
+  atomic_init(&ch->consumer, NULL);
+
+  return true;
+}
+
+// Despertar a la tarea anotada en `waiter`, si la hay
+static inline void wake(_Atomic(TaskHandle_t) *waiter)
+{
+  atomic_thread_fence(memory_order_seq_cst);
+  if (atomic_load_explicit(waiter, memory_order_relaxed) != NULL) {
+    TaskHandle_t task = atomic_exchange(waiter, NULL);
+    if (task != NULL) {
+      xTaskNotifyGive(task);
+    }
+  }
+}
+
+// Copiar `k` elementos entre el anillo (desde la posición `pos`) y `data`
+static inline void copy_in(spsc_chan_t *ch, uint32_t pos, const uint8_t *data, uint32_t k)
+{
+  uint32_t idx = pos & ch->mask;
+  uint32_t first = ch->mask + 1 - idx;
+
+  if (first > k) {
+    first = k;
+  }
+  memcpy(ch->buf + idx * ch->item_size, data, first * ch->item_size);
+  memcpy(ch->buf, data + first * ch->item_size, (k - first) * ch->item_size);
+}
+
+static inline void copy_out(spsc_chan_t *ch, uint32_t pos, uint8_t *data, uint32_t k)
+{
+  uint32_t idx = pos & ch->mask;
+  uint32_t first = ch->mask + 1 - idx;
+
+  if (first > k) {
+    first = k;
+  }
+  memcpy(data, ch->buf + idx * ch->item_size, first * ch->item_size);
+  memcpy(data + first * ch->item_size, ch->buf, (k - first) * ch->item_size);
+}
+
+size_t spsc_chan_push_n(spsc_chan_t *ch, const void *items, size_t n, TickType_t timeout)
+{
+  const uint8_t *src = (const uint8_t *)items;
+  uint32_t capacity = ch->mask + 1;
+  uint32_t head = atomic_load_explicit(&ch->head, memory_order_relaxed);
+  size_t done = 0;
+  TimeOut_t to;
+
+  vTaskSetTimeOutState(&to);
+
+  while (done < n) {
+    uint32_t free_slots = capacity - (head - ch->tail_cache);
+
+    if (free_slots == 0) {
+      ch->tail_cache = atomic_load_explicit(&ch->tail, memory_order_acquire);
+      free_slots = capacity - (head - ch->tail_cache);
+    }
+
+    if (free_slots > 0) {
+      uint32_t k = (n - done < free_slots) ? (uint32_t)(n - done) : free_slots;
+
+      copy_in(ch, head, src + done * ch->item_size, k);
+      head += k;
+      atomic_store_explicit(&ch->head, head, memory_order_release);
+      done += k;
+      wake(&ch->consumer);
+      continue;
+    }
+
+    // Lleno: anotarse y volver a mirar antes de dormir
+    atomic_store(&ch->producer, xTaskGetCurrentTaskHandle());
+    atomic_thread_fence(memory_order_seq_cst);
+    ch->tail_cache = atomic_load_explicit(&ch->tail, memory_order_acquire);
+    if (head - ch->tail_cache == capacity) {
+      if (xTaskCheckForTimeOut(&to, &timeout) != pdFALSE) {
+        atomic_store(&ch->producer, NULL);
+        break;
+      }
+      ulTaskNotifyTake(pdTRUE, timeout);
+    }
+    atomic_store(&ch->producer, NULL);
+  }
+
+  return done;
+}
+
+size_t spsc_chan_pop_n(spsc_chan_t *ch, void *items, size_t n, TickType_t timeout)
+{
+  uint8_t *dst = (uint8_t *)items;
+  uint32_t tail = atomic_load_explicit(&ch->tail, memory_order_relaxed);
+  TimeOut_t to;
+
+  if (n == 0) {
+    return 0;
+  }
+
+  vTaskSetTimeOutState(&to);
+
+  while (1) {
+    uint32_t avail = ch->head_cache - tail;
+
+    if (avail == 0) {
+      ch->head_cache = atomic_load_explicit(&ch->head, memory_order_acquire);
+      avail = ch->head_cache - tail;
+    }
+
+    if (avail > 0) {
+      uint32_t k = (n < avail) ? (uint32_t)n : avail;
+
+      copy_out(ch, tail, dst, k);
+      atomic_store_explicit(&ch->tail, tail + k, memory_order_release);
+      wake(&ch->producer);
+      return k;
+    }
+
+    // Vacío: anotarse y volver a mirar antes de dormir
+    atomic_store(&ch->consumer, xTaskGetCurrentTaskHandle());
+    atomic_thread_fence(memory_order_seq_cst);
+    ch->head_cache = atomic_load_explicit(&ch->head, memory_order_acquire);
+    if (ch->head_cache == tail) {
+      if (xTaskCheckForTimeOut(&to, &timeout) != pdFALSE) {
+        atomic_store(&ch->consumer, NULL);
+        return 0;
+      }
+      ulTaskNotifyTake(pdTRUE, timeout);
+    }
+    atomic_store(&ch->consumer, NULL);
+  }
+}
+
+uint32_t spsc_chan_count(spsc_chan_t *ch)
+{
+  uint32_t tail = atomic_load_explicit(&ch->tail, memory_order_acquire);
+  uint32_t head = atomic_load_explicit(&ch->head, memory_order_acquire);
+
+  return head - tail;
+}
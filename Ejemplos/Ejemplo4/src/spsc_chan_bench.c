@@ -0,0 +1,256 @@
+/**
+ *
+ * Resumen:
+ * Medición del canal SPSC contra xQueueSend/xQueueReceive con el productor y
+ * el consumidor en núcleos distintos.
+ *
+ * - Caudal: elementos por segundo para varios tamaños de elemento y
+ *   profundidades, enviando de a uno y en bloques de BENCH_BULK.
+ * - Latencia: ida y vuelta de un elemento entre dos tareas (ping-pong), que
+ *   pasa siempre por la espera bloqueante; se informa la mitad.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "spsc_chan.h"
+
+#include "bench_clock.h"
+
+// Configuración
+#define BENCH_ITEMS       (20000)   // Elementos por prueba de caudal
+#define BENCH_BULK        (16)      // Elementos por push_n/pop_n
+#define BENCH_PINGS       (2000)    // Idas y vueltas para la latencia
+#define BENCH_MAX_SIZE    (64)
+#define BENCH_MAX_DEPTH   (64)
+
+#if CONFIG_FREERTOS_UNICORE
+  #define BENCH_CORE_TX   (0)
+  #define BENCH_CORE_RX   (0)
+#else
+  #define BENCH_CORE_TX   (0)
+  #define BENCH_CORE_RX   (1)
+#endif
+
+typedef enum {
+  MODE_QUEUE,
+  MODE_SPSC,
+  MODE_SPSC_BULK,
+} bench_mode_t;
+
+static const char *const mode_name[] = { "xQueue", "spsc", "spsc x16" };
+
+typedef struct {
+  bench_mode_t mode;
+  uint32_t size;
+  QueueHandle_t queue;
+  spsc_chan_t chan;
+  uint32_t errors;                  // Elementos fuera de orden
+} bench_ctx_t;
+
+static bench_ctx_t ctx;
+static uint8_t chan_buf[BENCH_MAX_DEPTH * BENCH_MAX_SIZE];
+static SemaphoreHandle_t done_sem;
+
+// Numerar cada elemento en sus primeros 4 bytes para verificar el orden
+static void benchTx(void *parameters)
+{
+  uint8_t items[BENCH_BULK][BENCH_MAX_SIZE];
+  uint32_t seq = 0;
+
+  memset(items, 0xAB, sizeof(items));
+
+  while (seq < BENCH_ITEMS) {
+    if (ctx.mode == MODE_SPSC_BULK) {
+      uint32_t k = (BENCH_ITEMS - seq < BENCH_BULK) ? BENCH_ITEMS - seq : BENCH_BULK;
+      for (uint32_t i = 0; i < k; i++) {
+        memcpy(items[i], &(uint32_t){ seq + i }, sizeof(uint32_t));
+      }
+      seq += spsc_chan_push_n(&ctx.chan, items, k, portMAX_DELAY);
+    } else {
+      memcpy(items[0], &seq, sizeof(seq));
+      if (ctx.mode == MODE_QUEUE) {
+        xQueueSend(ctx.queue, items[0], portMAX_DELAY);
+      } else {
+        spsc_chan_push(&ctx.chan, items[0], portMAX_DELAY);
+      }
+      seq++;
+    }
+  }
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static void benchRx(void *parameters)
+{
+  uint8_t items[BENCH_BULK][BENCH_MAX_SIZE];
+  uint32_t seq = 0;
+
+  while (seq < BENCH_ITEMS) {
+    uint32_t k = 1;
+
+    if (ctx.mode == MODE_SPSC_BULK) {
+      k = spsc_chan_pop_n(&ctx.chan, items, BENCH_BULK, portMAX_DELAY);
+    } else if (ctx.mode == MODE_QUEUE) {
+      xQueueReceive(ctx.queue, items[0], portMAX_DELAY);
+    } else {
+      spsc_chan_pop(&ctx.chan, items[0], portMAX_DELAY);
+    }
+
+    for (uint32_t i = 0; i < k; i++) {
+      uint32_t got;
+      memcpy(&got, items[i], sizeof(got));
+      ctx.errors += (got != seq);
+      seq++;
+    }
+  }
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+// Caudal de un modo para un tamaño y una profundidad
+static void bench_throughput(bench_mode_t mode, uint32_t size, uint32_t depth)
+{
+  ctx.mode = mode;
+  ctx.size = size;
+  ctx.errors = 0;
+  ctx.queue = NULL;
+
+  if (mode == MODE_QUEUE) {
+    ctx.queue = xQueueCreate(depth, size);
+  } else {
+    spsc_chan_init(&ctx.chan, chan_buf, depth, size);
+  }
+
+  int64_t t0 = esp_timer_get_time();
+  xTaskCreatePinnedToCore(benchRx, "Rx", 3072, NULL, 5, NULL, BENCH_CORE_RX);
+  xTaskCreatePinnedToCore(benchTx, "Tx", 3072, NULL, 5, NULL, BENCH_CORE_TX);
+  xSemaphoreTake(done_sem, portMAX_DELAY);
+  xSemaphoreTake(done_sem, portMAX_DELAY);
+  int64_t dt = esp_timer_get_time() - t0;
+
+  if (dt <= 0) {
+    dt = 1;
+  }
+  printf("%-8s | %3lu B | prof %2lu | %9.0f elem/s | %6.2f us/elem%s\n",
+         mode_name[mode], (unsigned long)size, (unsigned long)depth,
+         (double)BENCH_ITEMS * 1e6 / (double)dt, (double)dt / BENCH_ITEMS,
+         ctx.errors ? "  (ERROR de orden)" : "");
+
+  if (ctx.queue != NULL) {
+    vQueueDelete(ctx.queue);
+  }
+}
+
+//*****************************************************************************
+// Latencia (ping-pong)
+
+static bench_mode_t pp_mode;
+static QueueHandle_t pp_queue[2];
+static spsc_chan_t pp_chan[2];
+static uint32_t pp_buf[2][8];
+
+static void pp_send(int dir, uint32_t v)
+{
+  if (pp_mode == MODE_QUEUE) {
+    xQueueSend(pp_queue[dir], &v, portMAX_DELAY);
+  } else {
+    spsc_chan_push(&pp_chan[dir], &v, portMAX_DELAY);
+  }
+}
+
+static uint32_t pp_recv(int dir)
+{
+  uint32_t v = 0;
+
+  if (pp_mode == MODE_QUEUE) {
+    xQueueReceive(pp_queue[dir], &v, portMAX_DELAY);
+  } else {
+    spsc_chan_pop(&pp_chan[dir], &v, portMAX_DELAY);
+  }
+  return v;
+}
+
+// Devuelve cada elemento por el canal de vuelta
+static void benchEcho(void *parameters)
+{
+  for (int i = 0; i < BENCH_PINGS; i++) {
+    pp_send(1, pp_recv(0));
+  }
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static void bench_latency(bench_mode_t mode)
+{
+  uint64_t sum = 0;
+  uint32_t max = 0;
+
+  pp_mode = mode;
+  for (int d = 0; d < 2; d++) {
+    if (mode == MODE_QUEUE) {
+      pp_queue[d] = xQueueCreate(8, sizeof(uint32_t));
+    } else {
+      spsc_chan_init(&pp_chan[d], pp_buf[d], 8, sizeof(uint32_t));
+    }
+  }
+
+  xTaskCreatePinnedToCore(benchEcho, "Eco", 2048, NULL, 5, NULL, BENCH_CORE_RX);
+
+  for (int i = 0; i < BENCH_PINGS; i++) {
+    uint32_t t0 = bench_ticks();
+    pp_send(0, i);
+    pp_recv(1);
+    uint32_t dt = bench_ticks() - t0;
+
+    sum += dt;
+    if (dt > max) {
+      max = dt;
+    }
+  }
+  xSemaphoreTake(done_sem, portMAX_DELAY);
+
+  printf("%-8s | un sentido: media %7.1f %s | max %7lu %s\n",
+         mode_name[mode], (double)sum / BENCH_PINGS / 2, BENCH_TICK_UNIT,
+         (unsigned long)(max / 2), BENCH_TICK_UNIT);
+
+  if (mode == MODE_QUEUE) {
+    vQueueDelete(pp_queue[0]);
+    vQueueDelete(pp_queue[1]);
+  }
+}
+
+void spsc_chan_benchmark(void)
+{
+  static const uint32_t sizes[] = { 4, 16, 64 };
+  static const uint32_t depths[] = { 8, 64 };
+
+  done_sem = xSemaphoreCreateCounting(2, 0);
+
+  printf("---Medición canal SPSC vs xQueue (%d elementos, Tx núcleo %d, Rx núcleo %d)---\n",
+         BENCH_ITEMS, BENCH_CORE_TX, BENCH_CORE_RX);
+
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    for (size_t d = 0; d < sizeof(depths) / sizeof(depths[0]); d++) {
+      bench_throughput(MODE_QUEUE, sizes[s], depths[d]);
+      bench_throughput(MODE_SPSC, sizes[s], depths[d]);
+      bench_throughput(MODE_SPSC_BULK, sizes[s], depths[d]);
+    }
+  }
+
+  printf("---Latencia (ping-pong de 4 bytes, %d idas y vueltas)---\n", BENCH_PINGS);
+  bench_latency(MODE_QUEUE);
+  bench_latency(MODE_SPSC);
+
+  vSemaphoreDelete(done_sem);
+}
@@ -0,0 +1,66 @@
+/**
+ *
+ * Resumen:
+ * Bloqueo justo (FIFO) con entrega directa, para reemplazar el lazo de
+ * "intentar con xSemaphoreTake(mutex, 0) y dormir un tick": a 100 Hz cada
+ * intento fallido suma 10 ms y el orden en que las tareas obtienen el mutex
+ * no está definido.
+ *
+ * - Las tareas que lo encuentran ocupado se encolan en orden de llegada y
+ *   se bloquean esperando una notificación de tarea (índice 0).
+ * - Al liberarlo, el dueño lo pasa directamente a la primera de la cola y la
+ *   despierta: nadie puede adelantarse entre la liberación y el despertar.
+ * - El nodo de cada espera vive en la pila de la tarea que espera.
+ * - No hereda prioridades (a diferencia del mutex de FreeRTOS) y no se puede
+ *   usar desde una ISR.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef FAIR_LOCK_H
+#define FAIR_LOCK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+typedef struct fair_waiter {
+  TaskHandle_t task;
+  struct fair_waiter *next;
+  bool granted;                   // El dueño anterior le entregó el bloqueo
+} fair_waiter_t;
+
+typedef struct {
+  portMUX_TYPE mux;
+  TaskHandle_t owner;             // NULL si está libre
+  fair_waiter_t *head;            // Primera tarea en espera
+  fair_waiter_t *tail;
+  uint32_t handoffs;              // Entregas directas a una tarea en espera
+} fair_lock_t;
+
+void fair_lock_init(fair_lock_t *lock);
+
+/**
+ * @brief Tomar el bloqueo, esperando en orden de llegada hasta `timeout`
+ *
+ * @return pdTRUE si se obtuvo
+ */
+BaseType_t fair_lock_take(fair_lock_t *lock, TickType_t timeout);
+
+/**
+ * @brief Liberar el bloqueo (solo el dueño) y entregarlo a la primera tarea en espera
+ */
+void fair_lock_give(fair_lock_t *lock);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar latencia de adquisición y reparto entre tareas del lazo
+ *        de reintento actual, el mutex bloqueante y el bloqueo justo
+ */
+void fair_lock_benchmark(void);
+
+#endif // FAIR_LOCK_H
@@ -0,0 +1,150 @@
+/**
+ *
+ * Resumen:
+ * Primitivas sin bloqueo para datos compartidos chicos, como alternativa a un
+ * mutex de FreeRTOS alrededor de una actualización de pocas instrucciones:
+ *
+ * - lf_counter_t: contador atómico de 32 bits (en el ESP32 usa S32C1I, sin
+ *   sección crítica; los atómicos de 64 bits sí la usan, por eso se evitan).
+ * - lf_seqlock_t: lock de secuencia para leer una instantánea de varias
+ *   palabras sin bloquear al escritor. Un solo escritor (o escritores ya
+ *   serializados); los lectores reintentan si la secuencia cambió.
+ * - lf_sharded_t: contador repartido por núcleo: cada núcleo suma en su
+ *   propia línea de caché y la lectura suma todas las partes.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef LF_SYNC_H
+#define LF_SYNC_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define LF_CACHE_LINE   (32)
+
+//*****************************************************************************
+// Contador atómico
+
+typedef struct {
+  _Atomic uint32_t value;
+} lf_counter_t;
+
+#define LF_COUNTER_INIT   { 0 }
+
+// Devuelve el valor anterior
+static inline uint32_t lf_counter_add(lf_counter_t *c, uint32_t n)
+{
+  return atomic_fetch_add_explicit(&c->value, n, memory_order_relaxed);
+}
+
+static inline uint32_t lf_counter_read(lf_counter_t *c)
+{
+  return atomic_load_explicit(&c->value, memory_order_relaxed);
+}
+
+//*****************************************************************************
+// Lock de secuencia (impar mientras el escritor modifica)
+
+typedef struct {
+  _Atomic uint32_t seq;
+} lf_seqlock_t;
+
+#define LF_SEQLOCK_INIT   { 0 }
+
+static inline void lf_seq_write_begin(lf_seqlock_t *s)
+{
+  atomic_store_explicit(&s->seq, atomic_load_explicit(&s->seq, memory_order_relaxed) + 1,
+                        memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+}
+
+static inline void lf_seq_write_end(lf_seqlock_t *s)
+{
+  atomic_store_explicit(&s->seq, atomic_load_explicit(&s->seq, memory_order_relaxed) + 1,
+                        memory_order_release);
+}
+
+static inline uint32_t lf_seq_read_begin(lf_seqlock_t *s)
+{
+  uint32_t seq;
+
+  while ((seq = atomic_load_explicit(&s->seq, memory_order_acquire)) & 1) {
+    // Escritura en curso
+  }
+  return seq;
+}
+
+// Verdadero si hay que repetir la lectura
+static inline bool lf_seq_read_retry(lf_seqlock_t *s, uint32_t seq)
+{
+  atomic_thread_fence(memory_order_acquire);
+  return atomic_load_explicit(&s->seq, memory_order_relaxed) != seq;
+}
+
+// Publicar `size` bytes de `src` en `shared`
+static inline void lf_seq_write(lf_seqlock_t *s, volatile void *shared, const void *src, size_t size)
+{
+  lf_seq_write_begin(s);
+  memcpy((void *)shared, src, size);
+  lf_seq_write_end(s);
+}
+
+// Copiar una instantánea coherente de `shared`; devuelve los reintentos
+static inline uint32_t lf_seq_read(lf_seqlock_t *s, void *dst, const volatile void *shared, size_t size)
+{
+  uint32_t retries = 0;
+
+  while (1) {
+    uint32_t seq = lf_seq_read_begin(s);
+
+    memcpy(dst, (const void *)shared, size);
+    if (!lf_seq_read_retry(s, seq)) {
+      return retries;
+    }
+    retries++;
+  }
+}
+
+//*****************************************************************************
+// Contador repartido por núcleo
+
+typedef struct {
+  struct {
+    _Atomic uint32_t value;
+  } __attribute__((aligned(LF_CACHE_LINE))) shard[portNUM_PROCESSORS];
+} lf_sharded_t;
+
+// Atómico dentro de la parte: sigue siendo correcto si la tarea cambia de núcleo
+static inline void lf_sharded_add(lf_sharded_t *c, uint32_t n)
+{
+  atomic_fetch_add_explicit(&c->shard[xPortGetCoreID()].value, n, memory_order_relaxed);
+}
+
+static inline uint32_t lf_sharded_read(lf_sharded_t *c)
+{
+  uint32_t sum = 0;
+
+  for (int i = 0; i < portNUM_PROCESSORS; i++) {
+    sum += atomic_load_explicit(&c->shard[i].value, memory_order_relaxed);
+  }
+  return sum;
+}
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar actualizaciones por segundo de mutex, portENTER_CRITICAL,
+ *        contador atómico y contador por núcleo, en uno y en dos núcleos,
+ *        y el lock de secuencia con un escritor y un lector
+ */
+void lf_sync_benchmark(void);
+
+#endif // LF_SYNC_H
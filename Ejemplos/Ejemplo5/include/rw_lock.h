@@ -0,0 +1,85 @@
+/**
+ *
+ * Resumen:
+ * Bloqueo de lectores/escritor para datos que se leen mucho y se escriben
+ * poco (tablas de configuración o calibración). Varias tareas pueden leer a
+ * la vez, en cualquier núcleo; un escritor tiene acceso exclusivo.
+ *
+ * - Los escritores se serializan con un mutex de FreeRTOS que retienen
+ *   mientras escriben: cualquier tarea que espera detrás de un escritor
+ *   (lectora o escritora) se bloquea en ese mutex y le hereda su prioridad.
+ * - RW_PREFER_READERS: un lector entra mientras no haya un escritor activo,
+ *   aunque haya uno esperando (máximo paralelismo, el escritor puede esperar
+ *   indefinidamente si siempre hay lectores).
+ * - RW_PREFER_WRITERS: con un escritor esperando, los lectores nuevos se
+ *   bloquean hasta que termine; el último lector que sale le entrega el
+ *   bloqueo con una notificación de tarea (índice 0).
+ * - Los lectores que ya están adentro no heredan la prioridad del escritor
+ *   que espera: las secciones de lectura tienen que ser cortas.
+ * - No es recursivo y no se puede usar desde una ISR.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef RW_LOCK_H
+#define RW_LOCK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+typedef enum {
+  RW_PREFER_READERS,
+  RW_PREFER_WRITERS,
+} rw_mode_t;
+
+typedef struct {
+  portMUX_TYPE mux;
+  SemaphoreHandle_t wmutex;       // Retenido por el escritor en espera o activo
+  rw_mode_t mode;
+  uint32_t readers;               // Lectores adentro
+  TaskHandle_t writer;            // Escritor que retiene wmutex, NULL si no hay
+  bool writer_active;             // El escritor ya tiene acceso exclusivo
+} rw_lock_t;
+
+/**
+ * @brief Inicializar el bloqueo
+ *
+ * @return false si no se pudo crear el mutex interno
+ */
+bool rw_lock_init(rw_lock_t *lock, rw_mode_t mode);
+
+void rw_lock_delete(rw_lock_t *lock);
+
+/**
+ * @brief Entrar como lector, esperando hasta `timeout`
+ *
+ * @return pdTRUE si se obtuvo
+ */
+BaseType_t rw_read_lock(rw_lock_t *lock, TickType_t timeout);
+
+void rw_read_unlock(rw_lock_t *lock);
+
+/**
+ * @brief Entrar como escritor, esperando hasta `timeout` a otros escritores
+ *        y a que salgan los lectores
+ *
+ * @return pdTRUE si se obtuvo
+ */
+BaseType_t rw_write_lock(rw_lock_t *lock, TickType_t timeout);
+
+void rw_write_unlock(rw_lock_t *lock);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar lecturas por segundo de un mutex y del bloqueo de
+ *        lectores/escritor (en sus dos modos) a medida que crecen los lectores
+ */
+void rw_lock_benchmark(void);
+
+#endif // RW_LOCK_H
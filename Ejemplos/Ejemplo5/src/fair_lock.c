@@ -0,0 +1,113 @@
+/**
+ *
+ * Resumen:
+ * Implementación del bloqueo justo con entrega directa (ver fair_lock.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include "fair_lock.h"
+
+void fair_lock_init(fair_lock_t *lock)
+{
+  portMUX_INITIALIZE(&lock->mux);
+  lock->owner = NULL;
+  lock->head = NULL;
+  lock->tail = NULL;
+  lock->handoffs = 0;
+}
+
+// Sacar un nodo de la cola (con la sección crítica tomada)
+static void unlink_waiter(fair_lock_t *lock, fair_waiter_t *w)
+{
+  fair_waiter_t **pp = &lock->head;
+  fair_waiter_t *prev = NULL;
+
+  while (*pp != NULL && *pp != w) {
+    prev = *pp;
+    pp = &(*pp)->next;
+  }
+  if (*pp == w) {
+    *pp = w->next;
+    if (lock->tail == w) {
+      lock->tail = prev;
+    }
+  }
+}
+
+BaseType_t fair_lock_take(fair_lock_t *lock, TickType_t timeout)
+{
+  TaskHandle_t me = xTaskGetCurrentTaskHandle();
+  fair_waiter_t w;
+  TimeOut_t to;
+
+  portENTER_CRITICAL(&lock->mux);
+  if (lock->owner == NULL) {
+    lock->owner = me;
+    portEXIT_CRITICAL(&lock->mux);
+    return pdTRUE;
+  }
+  if (timeout == 0) {
+    portEXIT_CRITICAL(&lock->mux);
+    return pdFALSE;
+  }
+
+  // Ocupado: encolarse al final
+  w.task = me;
+  w.next = NULL;
+  w.granted = false;
+  if (lock->tail != NULL) {
+    lock->tail->next = &w;
+  } else {
+    lock->head = &w;
+  }
+  lock->tail = &w;
+  portEXIT_CRITICAL(&lock->mux);
+
+  vTaskSetTimeOutState(&to);
+
+  while (1) {
+    // Una notificación vieja solo produce una vuelta más
+    ulTaskNotifyTake(pdTRUE, timeout);
+    bool expired = (xTaskCheckForTimeOut(&to, &timeout) != pdFALSE);
+
+    portENTER_CRITICAL(&lock->mux);
+    if (w.granted) {
+      portEXIT_CRITICAL(&lock->mux);
+      return pdTRUE;
+    }
+    if (expired) {
+      unlink_waiter(lock, &w);
+      portEXIT_CRITICAL(&lock->mux);
+      return pdFALSE;
+    }
+    portEXIT_CRITICAL(&lock->mux);
+  }
+}
+
+void fair_lock_give(fair_lock_t *lock)
+{
+  TaskHandle_t next = NULL;
+
+  portENTER_CRITICAL(&lock->mux);
+  fair_waiter_t *w = lock->head;
+  if (w != NULL) {
+    // Entregar al primero: el bloqueo nunca queda libre entre medio
+    lock->head = w->next;
+    if (lock->head == NULL) {
+      lock->tail = NULL;
+    }
+    next = w->task;
+    lock->owner = next;
+    lock->handoffs++;
+    w->granted = true;          // Después de esto el nodo puede dejar de existir
+  } else {
+    lock->owner = NULL;
+  }
+  portEXIT_CRITICAL(&lock->mux);
+
+  if (next != NULL) {
+    xTaskNotifyGive(next);
+  }
+}
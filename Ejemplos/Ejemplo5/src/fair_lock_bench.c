@@ -0,0 +1,198 @@
+/**
+ *
+ * Resumen:
+ * Medición de latencia de adquisición y reparto entre tareas para:
+ * - el lazo actual de incTask: xSemaphoreTake(mutex, 0) y vTaskDelay(1);
+ * - el mutex de FreeRTOS esperando con portMAX_DELAY;
+ * - el bloqueo justo con entrega directa.
+ *
+ * BENCH_TASKS tareas de igual prioridad, repartidas entre los núcleos, toman
+ * el bloqueo, lo retienen BENCH_HOLD_US, lo sueltan, trabajan BENCH_WORK_US y
+ * vuelven a pedirlo durante BENCH_RUN_MS. Se informa la latencia media y
+ * máxima desde el pedido hasta obtenerlo y el reparto: la diferencia entre
+ * la tarea que más veces lo obtuvo y la que menos, sobre el promedio.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "fair_lock.h"
+
+// Configuración
+#define BENCH_TASKS       (4)
+#define BENCH_RUN_MS      (2000)
+#define BENCH_HOLD_US     (200)     // Retención dentro de la sección crítica
+#define BENCH_WORK_US     (100)     // Trabajo fuera de la sección crítica
+
+#if CONFIG_FREERTOS_UNICORE
+  #define BENCH_CORES     (1)
+#else
+  #define BENCH_CORES     (2)
+#endif
+
+typedef enum {
+  METHOD_RETRY,
+  METHOD_MUTEX,
+  METHOD_FAIR,
+  METHOD_COUNT,
+} bench_method_t;
+
+static const char *const method_name[] = { "reintento+delay", "mutex bloqueante", "justo FIFO" };
+
+typedef struct {
+  uint32_t count;
+  uint64_t wait_sum_us;
+  uint32_t wait_max_us;
+} bench_task_t;
+
+static bench_method_t method;
+static bench_task_t results[BENCH_TASKS];
+static volatile bool running;
+static SemaphoreHandle_t mutex;
+static fair_lock_t fair;
+static SemaphoreHandle_t start_sem;
+static SemaphoreHandle_t done_sem;
+
+static void busy_us(uint32_t us)
+{
+  int64_t t0 = esp_timer_get_time();
+
+  while (esp_timer_get_time() - t0 < us) {
+  }
+}
+
+static void lock_take(void)
+{
+  switch (method) {
+    case METHOD_RETRY:
+      while (xSemaphoreTake(mutex, 0) != pdTRUE) {
+        vTaskDelay(1);
+      }
+      break;
+    case METHOD_MUTEX:
+      xSemaphoreTake(mutex, portMAX_DELAY);
+      break;
+    case METHOD_FAIR:
+    default:
+      fair_lock_take(&fair, portMAX_DELAY);
+      break;
+  }
+}
+
+static void lock_give(void)
+{
+  if (method == METHOD_FAIR) {
+    fair_lock_give(&fair);
+  } else {
+    xSemaphoreGive(mutex);
+  }
+}
+
+static void benchContender(void *parameters)
+{
+  bench_task_t *r = (bench_task_t *)parameters;
+
+  xSemaphoreTake(start_sem, portMAX_DELAY);
+
+  while (running) {
+    int64_t t0 = esp_timer_get_time();
+    lock_take();
+    uint32_t wait_us = (uint32_t)(esp_timer_get_time() - t0);
+
+    busy_us(BENCH_HOLD_US);
+    lock_give();
+
+    r->count++;
+    r->wait_sum_us += wait_us;
+    if (wait_us > r->wait_max_us) {
+      r->wait_max_us = wait_us;
+    }
+
+    busy_us(BENCH_WORK_US);
+  }
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static void bench_run(bench_method_t m)
+{
+  char name[BENCH_TASKS][8];
+  uint32_t total = 0;
+  uint32_t min = UINT32_MAX;
+  uint32_t max = 0;
+  uint32_t wait_max = 0;
+  uint64_t wait_sum = 0;
+
+  method = m;
+  running = true;
+
+  for (int i = 0; i < BENCH_TASKS; i++) {
+    results[i] = (bench_task_t){ 0 };
+    snprintf(name[i], sizeof(name[i]), "C%d", i);
+    xTaskCreatePinnedToCore(benchContender, name[i], 2048, &results[i], 5, NULL, i % BENCH_CORES);
+  }
+  for (int i = 0; i < BENCH_TASKS; i++) {
+    xSemaphoreGive(start_sem);
+  }
+
+  vTaskDelay(BENCH_RUN_MS / portTICK_PERIOD_MS);
+  running = false;
+  for (int i = 0; i < BENCH_TASKS; i++) {
+    xSemaphoreTake(done_sem, portMAX_DELAY);
+  }
+
+  for (int i = 0; i < BENCH_TASKS; i++) {
+    total += results[i].count;
+    wait_sum += results[i].wait_sum_us;
+    if (results[i].count < min) {
+      min = results[i].count;
+    }
+    if (results[i].count > max) {
+      max = results[i].count;
+    }
+    if (results[i].wait_max_us > wait_max) {
+      wait_max = results[i].wait_max_us;
+    }
+  }
+
+  printf("%-16s | tomas: %6lu | espera media: %7.1f us | máx: %6lu us | por tarea %lu..%lu (dif. %5.1f%%)\n",
+         method_name[m], (unsigned long)total,
+         total ? (double)wait_sum / total : 0.0, (unsigned long)wait_max,
+         (unsigned long)min, (unsigned long)max,
+         total ? 100.0 * (max - min) * BENCH_TASKS / total : 0.0);
+
+  vTaskDelay(1);
+}
+
+void fair_lock_benchmark(void)
+{
+  UBaseType_t prio = uxTaskPriorityGet(NULL);
+
+  // Por encima de las tareas que compiten, para poder cortar la medición a tiempo
+  vTaskPrioritySet(NULL, 6);
+
+  mutex = xSemaphoreCreateMutex();
+  fair_lock_init(&fair);
+  start_sem = xSemaphoreCreateCounting(BENCH_TASKS, 0);
+  done_sem = xSemaphoreCreateCounting(BENCH_TASKS, 0);
+
+  printf("---Medición de bloqueos (%d tareas en %d núcleo(s), %d ms, retención %d us)---\n",
+         BENCH_TASKS, BENCH_CORES, BENCH_RUN_MS, BENCH_HOLD_US);
+
+  for (int m = 0; m < METHOD_COUNT; m++) {
+    bench_run((bench_method_t)m);
+  }
+  printf("entregas directas del bloqueo justo: %lu\n", (unsigned long)fair.handoffs);
+
+  vSemaphoreDelete(mutex);
+  vSemaphoreDelete(start_sem);
+  vSemaphoreDelete(done_sem);
+
+  vTaskPrioritySet(NULL, prio);
+}
@@ -0,0 +1,226 @@
+/**
+ *
+ * Resumen:
+ * Medición de actualizaciones por segundo de un contador compartido con
+ * mutex, portENTER_CRITICAL, contador atómico y contador por núcleo, con dos
+ * tareas en el mismo núcleo y con una tarea en cada núcleo. Al final se
+ * verifica que no se perdió ninguna actualización.
+ *
+ * El lock de secuencia se mide aparte: un escritor publica un par de valores
+ * que deben ser coherentes y un lector en el otro núcleo toma instantáneas,
+ * contando reintentos y lecturas rotas (que tienen que ser 0).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "lf_sync.h"
+
+// Configuración
+#define BENCH_UPDATES     (100000)  // Actualizaciones por tarea
+#define BENCH_TASKS       (2)
+#define BENCH_SEQ_WRITES  (100000)
+
+#if CONFIG_FREERTOS_UNICORE
+  #define BENCH_CORE_B    (0)
+#else
+  #define BENCH_CORE_B    (1)
+#endif
+
+typedef enum {
+  METHOD_MUTEX,
+  METHOD_CRITICAL,
+  METHOD_ATOMIC,
+  METHOD_SHARDED,
+  METHOD_COUNT,
+} bench_method_t;
+
+static const char *const method_name[] = { "mutex", "portENTER_CRITICAL", "atómico", "por núcleo" };
+
+static bench_method_t method;
+static SemaphoreHandle_t start_sem;
+static SemaphoreHandle_t done_sem;
+
+static SemaphoreHandle_t mutex;
+static portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint32_t plain_val;
+static lf_counter_t counter;
+static lf_sharded_t sharded;
+
+static void benchUpdater(void *parameters)
+{
+  xSemaphoreTake(start_sem, portMAX_DELAY);
+
+  switch (method) {
+    case METHOD_MUTEX:
+      for (int i = 0; i < BENCH_UPDATES; i++) {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        plain_val++;
+        xSemaphoreGive(mutex);
+      }
+      break;
+    case METHOD_CRITICAL:
+      for (int i = 0; i < BENCH_UPDATES; i++) {
+        portENTER_CRITICAL(&mux);
+        plain_val++;
+        portEXIT_CRITICAL(&mux);
+      }
+      break;
+    case METHOD_ATOMIC:
+      for (int i = 0; i < BENCH_UPDATES; i++) {
+        lf_counter_add(&counter, 1);
+      }
+      break;
+    case METHOD_SHARDED:
+    default:
+      for (int i = 0; i < BENCH_UPDATES; i++) {
+        lf_sharded_add(&sharded, 1);
+      }
+      break;
+  }
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static uint32_t read_result(void)
+{
+  switch (method) {
+    case METHOD_ATOMIC:
+      return lf_counter_read(&counter);
+    case METHOD_SHARDED:
+      return lf_sharded_read(&sharded);
+    default:
+      return plain_val;
+  }
+}
+
+static void bench_counter(bench_method_t m, BaseType_t core_b)
+{
+  method = m;
+  plain_val = 0;
+  atomic_store(&counter.value, 0);
+  for (int i = 0; i < portNUM_PROCESSORS; i++) {
+    atomic_store(&sharded.shard[i].value, 0);
+  }
+
+  xTaskCreatePinnedToCore(benchUpdater, "Cont A", 2048, NULL, 5, NULL, 0);
+  xTaskCreatePinnedToCore(benchUpdater, "Cont B", 2048, NULL, 5, NULL, core_b);
+
+  int64_t t0 = esp_timer_get_time();
+  for (int i = 0; i < BENCH_TASKS; i++) {
+    xSemaphoreGive(start_sem);
+  }
+  for (int i = 0; i < BENCH_TASKS; i++) {
+    xSemaphoreTake(done_sem, portMAX_DELAY);
+  }
+  int64_t dt = esp_timer_get_time() - t0;
+  uint32_t total = read_result();
+
+  printf("%-18s | %-10s | %9.0f act/s | total %lu%s\n",
+         method_name[m], core_b == 0 ? "1 núcleo" : "2 núcleos",
+         (double)BENCH_UPDATES * BENCH_TASKS * 1e6 / (double)(dt ? dt : 1),
+         (unsigned long)total,
+         total != BENCH_UPDATES * BENCH_TASKS ? "  (PERDIDAS)" : "");
+
+  vTaskDelay(1);
+}
+
+//*****************************************************************************
+// Lock de secuencia
+
+typedef struct {
+  uint32_t count;
+  uint32_t twice;                   // Siempre 2 * count
+} bench_pair_t;
+
+static lf_seqlock_t seq = LF_SEQLOCK_INIT;
+static volatile bench_pair_t shared_pair;
+static volatile bool writing;
+static uint32_t reads;
+static uint32_t retries;
+static uint32_t torn;
+
+static void benchSeqWriter(void *parameters)
+{
+  bench_pair_t p;
+
+  xSemaphoreTake(start_sem, portMAX_DELAY);
+  for (uint32_t i = 1; i <= BENCH_SEQ_WRITES; i++) {
+    p.count = i;
+    p.twice = 2 * i;
+    lf_seq_write(&seq, &shared_pair, &p, sizeof(p));
+  }
+  writing = false;
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static void benchSeqReader(void *parameters)
+{
+  bench_pair_t p;
+
+  xSemaphoreTake(start_sem, portMAX_DELAY);
+  while (writing) {
+    retries += lf_seq_read(&seq, &p, &shared_pair, sizeof(p));
+    torn += (p.twice != 2 * p.count);
+    reads++;
+  }
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static void bench_seqlock(void)
+{
+  writing = true;
+  reads = 0;
+  retries = 0;
+  torn = 0;
+
+  xTaskCreatePinnedToCore(benchSeqWriter, "Escritor", 2048, NULL, 5, NULL, 0);
+  xTaskCreatePinnedToCore(benchSeqReader, "Lector", 2048, NULL, 5, NULL, BENCH_CORE_B);
+
+  int64_t t0 = esp_timer_get_time();
+  xSemaphoreGive(start_sem);
+  xSemaphoreGive(start_sem);
+  xSemaphoreTake(done_sem, portMAX_DELAY);
+  xSemaphoreTake(done_sem, portMAX_DELAY);
+  int64_t dt = esp_timer_get_time() - t0;
+
+  if (dt <= 0) {
+    dt = 1;
+  }
+  printf("seqlock: %9.0f escrituras/s | %9.0f lecturas/s | reintentos: %lu | rotas: %lu\n",
+         (double)BENCH_SEQ_WRITES * 1e6 / (double)dt, (double)reads * 1e6 / (double)dt,
+         (unsigned long)retries, (unsigned long)torn);
+}
+
+void lf_sync_benchmark(void)
+{
+  mutex = xSemaphoreCreateMutex();
+  start_sem = xSemaphoreCreateCounting(BENCH_TASKS, 0);
+  done_sem = xSemaphoreCreateCounting(BENCH_TASKS, 0);
+
+  printf("---Medición contador compartido (%d tareas x %d actualizaciones)---\n",
+         BENCH_TASKS, BENCH_UPDATES);
+
+  for (int m = 0; m < METHOD_COUNT; m++) {
+    bench_counter((bench_method_t)m, 0);
+#if !CONFIG_FREERTOS_UNICORE
+    bench_counter((bench_method_t)m, 1);
+#endif
+  }
+
+  bench_seqlock();
+
+  vSemaphoreDelete(mutex);
+  vSemaphoreDelete(start_sem);
+  vSemaphoreDelete(done_sem);
+}
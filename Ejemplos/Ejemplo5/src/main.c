@@ -1,6 +1,8 @@
 /*
  * Resumen:
  * Este código muestra cómo usar un mutex (semaforo) en FreeRTOS
+ * Con LOG_MUX_EN los mensajes de las tareas son registros completos en
+ * log_mux y una tarea de drenado los imprime sin mezclarse.
  * Documentación: https://www.freertos.org/Documentation/02-Kernel/02-Kernel-features/02-Queues-mutexes-and-semaphores/04-Mutexes
  *
  * Configuración GPIO:
@@ -16,9 +18,14 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/projdefs.h"
 #include "FreeRTOSConfig.h"
-
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "lock_prof.h"
+#include "log_mux.h"
+#include "lf_sync.h"
+#include "fair_lock.h"
+#include "rw_lock.h"
+#include "stack_prof.h"
 
 // Definir el número de núcleo a utilizar
 #if CONFIG_FREERTOS_UNICORE
@@ -27,9 +34,76 @@ static const BaseType_t app_cpu = 0;
 static const BaseType_t app_cpu = 1;
 #endif
 
+// Descomentar para medir la contención del mutex (reporte con 'l' o cada LOCK_PROF_DUMP_MS)
+//#define LOCK_PROF_EN
+#define LOCK_PROF_DUMP_MS 10000
+
+#ifdef LOCK_PROF_EN
+  #define TAKE(sem, ticks)  lock_prof_take(sem, ticks)
+  #define GIVE(sem)         lock_prof_give(sem)
+#else
+  #define TAKE(sem, ticks)  xSemaphoreTake(sem, ticks)
+  #define GIVE(sem)         xSemaphoreGive(sem)
+#endif
+
+// Descomentar para que cada mensaje sea un registro completo en log_mux en lugar de un printf
+//#define LOG_MUX_EN
+
+#ifdef LOG_MUX_EN
+  #define LOG_INIT()        uint8_t log_src = log_mux_register_self(&log_mux)
+  #define LOG(...)          log_mux_printf(&log_mux, log_src, __VA_ARGS__)
+#else
+  #define LOG_INIT()
+  #define LOG(...)          printf(__VA_ARGS__)
+#endif
+
+// Descomentar para incrementar con un contador atómico: sin mutex ni reintentos
+//#define LF_COUNTER_EN
+
+// Descomentar para comparar mutex, portENTER_CRITICAL y primitivas sin bloqueo al iniciar
+//#define LF_BENCH_EN
+
+// Descomentar para esperar el turno en un bloqueo justo (FIFO) en lugar de reintentar cada tick
+//#define FAIR_LOCK_EN
+
+// Descomentar para comparar latencia y reparto del reintento, el mutex y el bloqueo justo al iniciar
+//#define FAIR_BENCH_EN
+
+// Descomentar para leer una tabla de calibración desde ambos núcleos con un bloqueo de lectores/escritor
+//#define RW_LOCK_EN
+#define RW_MODE RW_PREFER_WRITERS
+
+// Descomentar para comparar lecturas por segundo del mutex y del bloqueo de lectores/escritor al iniciar
+//#define RW_BENCH_EN
+
+// Descomentar para informar periódicamente el peor caso de pila de todas las tareas
+//#define STACK_PROF_EN
+
 // Globales
+#ifdef LF_COUNTER_EN
+static lf_counter_t shared_counter = LF_COUNTER_INIT;
+#else
 static int shared_val = 0;
+#endif
 static SemaphoreHandle_t mutex;
+#ifdef LOG_MUX_EN
+// Multiplexor de registros: las tareas producen y solo el drenado escribe en la consola
+static log_mux_t log_mux;
+static uart_tx_backend_t log_be;
+static uart_tx_stage_t log_stage;
+#endif
+#ifdef FAIR_LOCK_EN
+static fair_lock_t fair;
+#endif
+#ifdef RW_LOCK_EN
+// Tabla que se lee seguido y se escribe poco; offset siempre vale -gain
+typedef struct {
+    int gain;
+    int offset;
+} calib_t;
+static calib_t calib = { 1, -1 };
+static rw_lock_t calib_lock;
+#endif
 
 //---------------------------------------------------------
 // Tareas
@@ -37,21 +111,54 @@ static SemaphoreHandle_t mutex;
 // Incrementar la variable compartida (emulando un proceso)
 void incTask(void *parameters)
 {
+    LOG_INIT();
+
+#ifdef LF_COUNTER_EN
+    // Bucle infinito
+    while(1)
+    {
+        // Leer e incrementar en una sola operación atómica
+        int new_val = (int)lf_counter_add(&shared_counter, 1) + 1;
+
+        // Imprimir el nuevo valor; el trabajo ocurre fuera de cualquier bloqueo
+        LOG("Valor Compartido = %d\n", new_val);
+        vTaskDelay((rand() % (500 - 100 + 1) + 100) / portTICK_PERIOD_MS);
+    }
+#elif defined(FAIR_LOCK_EN)
+    int local_var;
+
+    // Bucle infinito
+    while(1)
+    {
+        // Esperar el turno en orden de llegada: sin reintentos ni ticks perdidos
+        fair_lock_take(&fair, portMAX_DELAY);
+
+        local_var = shared_val;     // Leer el valor compartido
+        local_var++;                // Incrementar el valor
+        vTaskDelay((rand() % (500 - 100 + 1) + 100) / portTICK_PERIOD_MS);
+        shared_val = local_var;
+        // Imprimir el nuevo valor
+        LOG("Valor Compartido = %d\n", shared_val);
+
+        // Entregar el bloqueo a la otra tarea si está esperando
+        fair_lock_give(&fair);
+    }
+#else
     int local_var;
 
     // Bucle infinito
     while(1)
     {
-        if(xSemaphoreTake(mutex, 0) == pdTRUE)
+        if(TAKE(mutex, 0) == pdTRUE)
         {
             local_var = shared_val;     // Leer el valor compartido
             local_var++;                // Incrementar el valor
             vTaskDelay((rand() % (500 - 100 + 1) + 100) / portTICK_PERIOD_MS);
             shared_val = local_var;
             // Imprimir el nuevo valor
-            printf("Valor Compartido = %d\n", shared_val);
+            LOG("Valor Compartido = %d\n", shared_val);
 
-            xSemaphoreGive(mutex);
+            GIVE(mutex);
         }
         else
         {
@@ -59,21 +166,104 @@ void incTask(void *parameters)
             vTaskDelay(1);
         }
     }
+#endif
+}
+
+#ifdef RW_LOCK_EN
+// Leer la tabla de calibración; varias lectoras pueden estar adentro a la vez
+void readTask(void *parameters)
+{
+    calib_t local;
+    LOG_INIT();
+
+    // Bucle infinito
+    while(1)
+    {
+        rw_read_lock(&calib_lock, portMAX_DELAY);
+        local = calib;
+        rw_read_unlock(&calib_lock);
+
+        LOG("%s (núcleo %d): ganancia = %d, offset = %d%s\n", pcTaskGetName(NULL), xPortGetCoreID(),
+               local.gain, local.offset, local.offset != -local.gain ? " (INCONSISTENTE)" : "");
+        vTaskDelay((rand() % (500 - 100 + 1) + 100) / portTICK_PERIOD_MS);
+    }
+}
+
+// Actualizar la tabla de vez en cuando con acceso exclusivo
+void writeTask(void *parameters)
+{
+    LOG_INIT();
+
+    // Bucle infinito
+    while(1)
+    {
+        vTaskDelay(2000 / portTICK_PERIOD_MS);
+
+        rw_write_lock(&calib_lock, portMAX_DELAY);
+        calib.gain++;
+        vTaskDelay(50 / portTICK_PERIOD_MS);    // Escritura lenta: las lectoras esperan
+        calib.offset = -calib.gain;
+        rw_write_unlock(&calib_lock);
+
+        LOG("Calibración actualizada\n");
+    }
 }
+#endif
 
 void app_main() 
 {
+#ifdef STACK_PROF_EN
+    // Informe de pila de todas las tareas, también las del sistema (IDLE, Tmr Svc, esp_timer)
+    stack_prof_start(STACK_PROF_DEFAULT_PERIOD_MS, STACK_PROF_DEFAULT_MARGIN, 1, tskNO_AFFINITY);
+#endif
+
     // Esperar
     vTaskDelay(1000 / portTICK_PERIOD_MS);
 
     printf("---Demostración de Mutex FreeRTOS---\n");
 
+#ifdef LF_BENCH_EN
+    lf_sync_benchmark();
+#endif
+
+#ifdef FAIR_BENCH_EN
+    fair_lock_benchmark();
+#endif
+
+#ifdef RW_BENCH_EN
+    rw_lock_benchmark();
+#endif
+
     // Crear el mutex antes de iniciar las tareas
     mutex = xSemaphoreCreateMutex();
+#ifdef FAIR_LOCK_EN
+    fair_lock_init(&fair);
+#endif
+
+#ifdef LOG_MUX_EN
+    // Drenado hacia la consola con la prioridad más baja, antes que las tareas
+    log_mux_init(&log_mux);
+    uart_tx_backend_stdout(&log_be);
+    uart_tx_stage_init(&log_stage, &log_be, UART_TX_STAGE_LEN, portMAX_DELAY);
+    log_mux_start(&log_mux, &log_stage, LOG_MUX_DEFAULT_DRAIN_MS, 1, app_cpu);
+#endif
 
+#ifdef LOCK_PROF_EN
+    // Registrar el mutex y arrancar el monitor antes que las tareas
+    lock_prof_register(mutex, "mutex");
+    lock_prof_start(LOCK_PROF_DUMP_MS, 1, app_cpu);
+#endif
+
+#ifdef RW_LOCK_EN
+    // Una lectora en cada núcleo y la escritora con más prioridad
+    rw_lock_init(&calib_lock, RW_MODE);
+    xTaskCreatePinnedToCore(readTask, "Lectora0", 2500, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(readTask, "Lectora1", 2500, NULL, 1, NULL, app_cpu);
+    xTaskCreatePinnedToCore(writeTask, "Escritora", 2500, NULL, 2, NULL, app_cpu);
+#else
     // Iniciar la tarea 1
     xTaskCreatePinnedToCore(incTask, "Task1", 2000, NULL, 1, NULL, app_cpu);
     // Iniciar la tarea 2
     xTaskCreatePinnedToCore(incTask, "Task2", 2000, NULL, 1, NULL, app_cpu);
+#endif
 }
-```
\ No newline at end of file
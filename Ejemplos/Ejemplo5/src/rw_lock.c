@@ -0,0 +1,129 @@
+/**
+ *
+ * Resumen:
+ * Implementación del bloqueo de lectores/escritor (ver rw_lock.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include "rw_lock.h"
+
+bool rw_lock_init(rw_lock_t *lock, rw_mode_t mode)
+{
+  portMUX_INITIALIZE(&lock->mux);
+  lock->wmutex = xSemaphoreCreateMutex();
+  lock->mode = mode;
+  lock->readers = 0;
+  lock->writer = NULL;
+  lock->writer_active = false;
+
+  return lock->wmutex != NULL;
+}
+
+void rw_lock_delete(rw_lock_t *lock)
+{
+  vSemaphoreDelete(lock->wmutex);
+  lock->wmutex = NULL;
+}
+
+BaseType_t rw_read_lock(rw_lock_t *lock, TickType_t timeout)
+{
+  TimeOut_t to;
+
+  vTaskSetTimeOutState(&to);
+
+  while (1) {
+    portENTER_CRITICAL(&lock->mux);
+    bool blocked = lock->writer_active ||
+                   (lock->mode == RW_PREFER_WRITERS && lock->writer != NULL);
+    if (!blocked) {
+      lock->readers++;
+      portEXIT_CRITICAL(&lock->mux);
+      return pdTRUE;
+    }
+    portEXIT_CRITICAL(&lock->mux);
+
+    if (xTaskCheckForTimeOut(&to, &timeout) != pdFALSE) {
+      return pdFALSE;
+    }
+
+    // Esperar detrás del escritor en su mutex: le hereda la prioridad.
+    // Se devuelve enseguida y se vuelve a mirar el estado.
+    if (xSemaphoreTake(lock->wmutex, timeout) != pdTRUE) {
+      return pdFALSE;
+    }
+    xSemaphoreGive(lock->wmutex);
+  }
+}
+
+void rw_read_unlock(rw_lock_t *lock)
+{
+  TaskHandle_t wake = NULL;
+
+  portENTER_CRITICAL(&lock->mux);
+  lock->readers--;
+  if (lock->readers == 0 && lock->writer != NULL && !lock->writer_active) {
+    // Entregar al escritor en espera: ningún lector puede colarse entre medio
+    lock->writer_active = true;
+    wake = lock->writer;
+  }
+  portEXIT_CRITICAL(&lock->mux);
+
+  if (wake != NULL) {
+    xTaskNotifyGive(wake);
+  }
+}
+
+BaseType_t rw_write_lock(rw_lock_t *lock, TickType_t timeout)
+{
+  TimeOut_t to;
+
+  vTaskSetTimeOutState(&to);
+
+  // Un escritor a la vez; el que espera acá le hereda la prioridad al actual
+  if (xSemaphoreTake(lock->wmutex, timeout) != pdTRUE) {
+    return pdFALSE;
+  }
+  xTaskCheckForTimeOut(&to, &timeout);
+
+  portENTER_CRITICAL(&lock->mux);
+  lock->writer = xTaskGetCurrentTaskHandle();
+  if (lock->readers == 0) {
+    lock->writer_active = true;
+    portEXIT_CRITICAL(&lock->mux);
+    return pdTRUE;
+  }
+  portEXIT_CRITICAL(&lock->mux);
+
+  // Esperar a que salga el último lector
+  while (1) {
+    // Una notificación vieja solo produce una vuelta más
+    ulTaskNotifyTake(pdTRUE, timeout);
+    bool expired = (xTaskCheckForTimeOut(&to, &timeout) != pdFALSE);
+
+    portENTER_CRITICAL(&lock->mux);
+    if (lock->writer_active) {
+      portEXIT_CRITICAL(&lock->mux);
+      return pdTRUE;
+    }
+    if (expired) {
+      lock->writer = NULL;
+      portEXIT_CRITICAL(&lock->mux);
+      xSemaphoreGive(lock->wmutex);
+      return pdFALSE;
+    }
+    portEXIT_CRITICAL(&lock->mux);
+  }
+}
+
+void rw_write_unlock(rw_lock_t *lock)
+{
+  portENTER_CRITICAL(&lock->mux);
+  lock->writer_active = false;
+  lock->writer = NULL;
+  portEXIT_CRITICAL(&lock->mux);
+
+  // Despierta al que espere (lector o escritor) y deshace la herencia
+  xSemaphoreGive(lock->wmutex);
+}
@@ -0,0 +1,218 @@
+/**
+ *
+ * Resumen:
+ * Medición de lecturas por segundo de una tabla compartida protegida con un
+ * mutex de FreeRTOS y con el bloqueo de lectores/escritor (en sus dos modos),
+ * para 1, 2, 4 y 8 lectores repartidos entre los núcleos.
+ *
+ * Cada lector copia la tabla y trabaja BENCH_READ_US dentro de la sección de
+ * lectura. Un escritor de mayor prioridad reescribe la tabla cada tick; se
+ * informa cuántas escrituras logró y su espera máxima, y se cuentan las
+ * copias inconsistentes (que tienen que ser 0).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "rw_lock.h"
+
+// Configuración
+#define BENCH_MAX_READERS (8)
+#define BENCH_RUN_MS      (500)
+#define BENCH_READ_US     (20)      // Trabajo dentro de la sección de lectura
+#define BENCH_TABLE_WORDS (64)
+
+#if CONFIG_FREERTOS_UNICORE
+  #define BENCH_CORES     (1)
+#else
+  #define BENCH_CORES     (2)
+#endif
+
+typedef enum {
+  METHOD_MUTEX,
+  METHOD_RW_READERS,
+  METHOD_RW_WRITERS,
+  METHOD_COUNT,
+} bench_method_t;
+
+static const char *const method_name[] = { "mutex", "rw pref. lectores", "rw pref. escritor" };
+
+static const int reader_counts[] = { 1, 2, 4, 8 };
+
+static bench_method_t method;
+static volatile bool running;
+static SemaphoreHandle_t mutex;
+static rw_lock_t rw;
+static SemaphoreHandle_t start_sem;
+static SemaphoreHandle_t done_sem;
+
+static volatile uint32_t table[BENCH_TABLE_WORDS];  // Todas las palabras iguales
+static uint32_t reads[BENCH_MAX_READERS];
+static uint32_t inconsistent;
+static uint32_t writes;
+static uint32_t write_wait_max_us;
+
+static void busy_us(uint32_t us)
+{
+  int64_t t0 = esp_timer_get_time();
+
+  while (esp_timer_get_time() - t0 < us) {
+  }
+}
+
+static void read_lock(void)
+{
+  if (method == METHOD_MUTEX) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+  } else {
+    rw_read_lock(&rw, portMAX_DELAY);
+  }
+}
+
+static void read_unlock(void)
+{
+  if (method == METHOD_MUTEX) {
+    xSemaphoreGive(mutex);
+  } else {
+    rw_read_unlock(&rw);
+  }
+}
+
+static void benchReader(void *parameters)
+{
+  uint32_t *count = (uint32_t *)parameters;
+  uint32_t copy[BENCH_TABLE_WORDS];
+
+  xSemaphoreTake(start_sem, portMAX_DELAY);
+
+  while (running) {
+    read_lock();
+    for (int i = 0; i < BENCH_TABLE_WORDS; i++) {
+      copy[i] = table[i];
+    }
+    busy_us(BENCH_READ_US);
+    read_unlock();
+
+    if (copy[0] != copy[BENCH_TABLE_WORDS - 1]) {
+      inconsistent++;
+    }
+    (*count)++;
+  }
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static void benchWriter(void *parameters)
+{
+  xSemaphoreTake(start_sem, portMAX_DELAY);
+
+  while (running) {
+    int64_t t0 = esp_timer_get_time();
+    if (method == METHOD_MUTEX) {
+      xSemaphoreTake(mutex, portMAX_DELAY);
+    } else {
+      rw_write_lock(&rw, portMAX_DELAY);
+    }
+    uint32_t wait_us = (uint32_t)(esp_timer_get_time() - t0);
+
+    writes++;
+    for (int i = 0; i < BENCH_TABLE_WORDS; i++) {
+      table[i] = writes;
+    }
+
+    if (method == METHOD_MUTEX) {
+      xSemaphoreGive(mutex);
+    } else {
+      rw_write_unlock(&rw);
+    }
+
+    if (wait_us > write_wait_max_us) {
+      write_wait_max_us = wait_us;
+    }
+    vTaskDelay(1);
+  }
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static void bench_run(bench_method_t m, int n_readers)
+{
+  char name[BENCH_MAX_READERS][8];
+  uint32_t total = 0;
+
+  method = m;
+  running = true;
+  inconsistent = 0;
+  writes = 0;
+  write_wait_max_us = 0;
+
+  if (m != METHOD_MUTEX) {
+    rw_lock_init(&rw, m == METHOD_RW_READERS ? RW_PREFER_READERS : RW_PREFER_WRITERS);
+  }
+
+  for (int i = 0; i < n_readers; i++) {
+    reads[i] = 0;
+    snprintf(name[i], sizeof(name[i]), "L%d", i);
+    xTaskCreatePinnedToCore(benchReader, name[i], 2048, &reads[i], 5, NULL, i % BENCH_CORES);
+  }
+  xTaskCreatePinnedToCore(benchWriter, "Escritor", 2048, NULL, 6, NULL, 0);
+
+  int64_t t0 = esp_timer_get_time();
+  for (int i = 0; i <= n_readers; i++) {
+    xSemaphoreGive(start_sem);
+  }
+
+  vTaskDelay(BENCH_RUN_MS / portTICK_PERIOD_MS);
+  running = false;
+  for (int i = 0; i <= n_readers; i++) {
+    xSemaphoreTake(done_sem, portMAX_DELAY);
+  }
+  int64_t dt = esp_timer_get_time() - t0;
+
+  for (int i = 0; i < n_readers; i++) {
+    total += reads[i];
+  }
+  if (m != METHOD_MUTEX) {
+    rw_lock_delete(&rw);
+  }
+
+  printf("%-18s | %d lectores | %9.0f lect/s | escrituras: %4lu (espera máx %6lu us) | inconsistentes: %lu\n",
+         method_name[m], n_readers, (double)total * 1e6 / (double)(dt ? dt : 1),
+         (unsigned long)writes, (unsigned long)write_wait_max_us, (unsigned long)inconsistent);
+
+  vTaskDelay(1);
+}
+
+void rw_lock_benchmark(void)
+{
+  UBaseType_t prio = uxTaskPriorityGet(NULL);
+
+  // Por encima de lectores y escritor, para poder cortar la medición a tiempo
+  vTaskPrioritySet(NULL, 7);
+
+  mutex = xSemaphoreCreateMutex();
+  start_sem = xSemaphoreCreateCounting(BENCH_MAX_READERS + 1, 0);
+  done_sem = xSemaphoreCreateCounting(BENCH_MAX_READERS + 1, 0);
+
+  printf("---Medición lectores/escritor (%d ms por caso, lectura de %d us en %d núcleo(s))---\n",
+         BENCH_RUN_MS, BENCH_READ_US, BENCH_CORES);
+
+  for (size_t r = 0; r < sizeof(reader_counts) / sizeof(reader_counts[0]); r++) {
+    for (int m = 0; m < METHOD_COUNT; m++) {
+      bench_run((bench_method_t)m, reader_counts[r]);
+    }
+  }
+
+  vSemaphoreDelete(mutex);
+  vSemaphoreDelete(start_sem);
+  vSemaphoreDelete(done_sem);
+
+  vTaskPrioritySet(NULL, prio);
+}
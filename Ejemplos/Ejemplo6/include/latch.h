@@ -0,0 +1,89 @@
+/**
+ *
+ * Resumen:
+ * Sincronización de arranque sin contar con un semáforo:
+ *
+ * - latch_t: cuenta regresiva de un solo uso. Cada tarea llama a
+ *   latch_count_down al estar lista y quien espera se despierta una sola vez
+ *   cuando la cuenta llega a 0 (en lugar de N xSemaphoreTake, cada uno con
+ *   su despertar). Pueden esperar varias tareas a la vez; con cuenta 1 sirve
+ *   de compuerta de largada.
+ * - barrier_t: barrera cíclica para `parties` tareas. La última en llegar
+ *   libera a todas y la barrera queda lista para la vuelta siguiente.
+ *
+ * Los contadores se protegen con un portMUX y la espera es sobre un grupo de
+ * eventos estático: no hace falta un bit por tarea (xEventGroupSync limita a
+ * 24 tareas) y no se usa el heap. La barrera alterna dos bits entre vueltas
+ * para que una tarea atrasada no vea el bit de la vuelta siguiente.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef LATCH_H
+#define LATCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+
+typedef struct {
+  portMUX_TYPE mux;
+  uint32_t count;
+  EventGroupHandle_t events;
+  StaticEventGroup_t events_buf;
+} latch_t;
+
+typedef struct {
+  portMUX_TYPE mux;
+  uint32_t parties;
+  uint32_t arrived;               // Tareas esperando en la vuelta actual
+  uint32_t generation;            // Vueltas completadas
+  EventGroupHandle_t events;
+  StaticEventGroup_t events_buf;
+} barrier_t;
+
+//*****************************************************************************
+// Cuenta regresiva
+
+void latch_init(latch_t *latch, uint32_t count);
+void latch_delete(latch_t *latch);
+
+/**
+ * @brief Restar uno; la llamada que llega a 0 despierta a los que esperan
+ */
+void latch_count_down(latch_t *latch);
+
+/**
+ * @brief Esperar a que la cuenta llegue a 0
+ *
+ * @return pdTRUE si llegó antes de `timeout`
+ */
+BaseType_t latch_wait(latch_t *latch, TickType_t timeout);
+
+//*****************************************************************************
+// Barrera cíclica
+
+void barrier_init(barrier_t *barrier, uint32_t parties);
+void barrier_delete(barrier_t *barrier);
+
+/**
+ * @brief Esperar a que lleguen las `parties` tareas de esta vuelta
+ *
+ * Si vence, la tarea deja de contar para la vuelta (las demás siguen esperando).
+ *
+ * @return pdTRUE si se completó la vuelta antes de `timeout`
+ */
+BaseType_t barrier_wait(barrier_t *barrier, TickType_t timeout);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar el tiempo hasta que N tareas están listas contando con un
+ *        semáforo contra latch_wait, y las vueltas por segundo de la barrera
+ */
+void latch_benchmark(void);
+
+#endif // LATCH_H
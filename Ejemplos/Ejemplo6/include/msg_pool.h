@@ -0,0 +1,126 @@
+/**
+ *
+ * Resumen:
+ * Mensajes sin copia: el productor toma prestado un búfer de un pool, lo
+ * llena y envía por la cola solo su puntero (4 bytes) en lugar del contenido.
+ * El dueño pasa a ser el consumidor, que devuelve el búfer al pool cuando
+ * termina.
+ *
+ * - Cada búfer lleva un contador de referencias atómico: para repartir el
+ *   mismo mensaje a varios consumidores (msg_publish) se suma una referencia
+ *   por cola y cada consumidor libera la suya; el último lo devuelve al pool.
+ * - msg_pool_get puede esperar un búfer libre con un tiempo máximo (semáforo
+ *   contador de búferes libres), así el pool limita al productor.
+ * - Almacenamiento y semáforo estáticos (MSG_POOL_STORAGE): no usa el heap.
+ * - Una cola de mensajes se crea con xQueueCreate(largo, sizeof(msg_buf_t *)).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef MSG_POOL_H
+#define MSG_POOL_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#define MSG_POOL_ALIGN        (8)
+
+struct msg_pool;
+
+typedef struct msg_buf {
+  struct msg_pool *pool;
+  struct msg_buf *next;           // Enlace en la lista de libres
+  _Atomic uint32_t refs;
+  uint32_t len;                   // Bytes útiles de data (lo fija el productor)
+  uint8_t data[] __attribute__((aligned(MSG_POOL_ALIGN)));
+} msg_buf_t;
+
+typedef struct msg_pool {
+  uint8_t *base;
+  msg_buf_t *free_list;
+  size_t block_size;              // Cabecera + contenido, alineado
+  uint32_t capacity;              // Bytes de contenido por búfer
+  uint32_t num_bufs;
+  uint32_t used;                  // Búferes prestados
+  uint32_t peak;
+  uint32_t failed;                // Pedidos que vencieron sin búfer
+  portMUX_TYPE lock;
+  SemaphoreHandle_t free_sem;     // Cuenta los búferes libres
+  StaticSemaphore_t free_sem_buf;
+} msg_pool_t;
+
+// Tamaño de un búfer con `capacity` bytes de contenido
+#define MSG_POOL_BLOCK(capacity) \
+  ((sizeof(msg_buf_t) + (capacity) + MSG_POOL_ALIGN - 1) & ~(size_t)(MSG_POOL_ALIGN - 1))
+
+// Declarar almacenamiento estático para `count` búferes de `capacity` bytes
+#define MSG_POOL_STORAGE(name, capacity, count) \
+  static uint8_t name[MSG_POOL_BLOCK(capacity) * (count)] __attribute__((aligned(MSG_POOL_ALIGN)))
+
+/**
+ * @brief Iniciar un pool sobre almacenamiento declarado con MSG_POOL_STORAGE
+ */
+bool msg_pool_init(msg_pool_t *pool, void *storage, uint32_t capacity, uint32_t num_bufs);
+
+/**
+ * @brief Tomar prestado un búfer (una referencia, len = 0)
+ *
+ * @return NULL si no se liberó ninguno antes de `timeout`
+ */
+msg_buf_t *msg_pool_get(msg_pool_t *pool, TickType_t timeout);
+
+// Sumar `n` referencias (antes de entregar el búfer a otros dueños)
+static inline void msg_buf_retain(msg_buf_t *buf, uint32_t n)
+{
+  atomic_fetch_add_explicit(&buf->refs, n, memory_order_relaxed);
+}
+
+/**
+ * @brief Soltar una referencia; la última devuelve el búfer al pool
+ */
+void msg_buf_release(msg_buf_t *buf);
+
+/**
+ * @brief Enviar el búfer por una cola de punteros
+ *
+ * Si se envía, la referencia pasa al consumidor; si no, sigue siendo del que llama.
+ */
+static inline bool msg_send(QueueHandle_t queue, msg_buf_t *buf, TickType_t timeout)
+{
+  return xQueueSend(queue, &buf, timeout) == pdTRUE;
+}
+
+// Recibir un búfer (el que recibe lo tiene que liberar); NULL si venció el tiempo
+static inline msg_buf_t *msg_recv(QueueHandle_t queue, TickType_t timeout)
+{
+  msg_buf_t *buf = NULL;
+
+  xQueueReceive(queue, &buf, timeout);
+  return buf;
+}
+
+/**
+ * @brief Repartir el mismo búfer a varias colas sin copiarlo
+ *
+ * Consume la referencia del que llama: después no hay que liberarlo.
+ *
+ * @return Colas a las que se entregó
+ */
+uint32_t msg_publish(QueueHandle_t *queues, uint32_t num_queues, msg_buf_t *buf, TickType_t timeout);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar el caudal de xQueueSend por valor contra el envío de
+ *        punteros a búferes del pool para varios tamaños de contenido
+ */
+void msg_pool_benchmark(void);
+
+#endif // MSG_POOL_H
@@ -0,0 +1,118 @@
+/**
+ *
+ * Resumen:
+ * Pool de tareas trabajadoras persistentes con una cola de trabajos acotada,
+ * en lugar de crear una tarea por trabajo y borrarla al terminar (cada
+ * creación reserva TCB y pila en el heap, y la memoria recién se libera
+ * cuando corre la tarea IDLE).
+ *
+ * - Un trabajo es una función y su argumento; se copia por valor en una cola
+ *   de FreeRTOS de largo fijo, así submit puede esperar o fallar si el pool
+ *   está saturado.
+ * - Cantidad de trabajadoras configurable por núcleo; todas toman trabajos
+ *   de la misma cola.
+ * - Futuro opcional por trabajo: lo declara el que envía (puede vivir en su
+ *   pila) y espera el resultado con wp_future_wait, que se bloquea con una
+ *   notificación de tarea (índice 0).
+ * - Estadísticas de trabajos hechos y latencia desde el envío hasta que una
+ *   trabajadora lo empieza.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#define WORKER_POOL_MAX   (8)       // Trabajadoras en total
+
+typedef void *(*wp_job_fn_t)(void *arg);
+
+typedef struct {
+  volatile bool done;
+  void *result;                   // Lo que devolvió la función del trabajo
+  TaskHandle_t waiter;            // Tarea bloqueada en wp_future_wait
+} wp_future_t;
+
+typedef struct {
+  uint8_t workers_per_core[portNUM_PROCESSORS];
+  uint32_t queue_len;             // Trabajos pendientes como máximo
+  uint32_t stack_size;
+  UBaseType_t priority;
+} worker_pool_config_t;
+
+typedef struct {
+  uint32_t submitted;
+  uint32_t done;
+  uint32_t rejected;              // submit que venció con la cola llena
+  uint64_t latency_sum_us;        // Desde el envío hasta el inicio
+  uint32_t latency_max_us;
+} worker_pool_stats_t;
+
+typedef struct {
+  QueueHandle_t jobs;
+  SemaphoreHandle_t exit_sem;     // Cada trabajadora lo da al terminar
+  TaskHandle_t workers[WORKER_POOL_MAX];
+  uint32_t num_workers;
+  portMUX_TYPE mux;               // Estadísticas y futuros
+  worker_pool_stats_t stats;
+} worker_pool_t;
+
+/**
+ * @brief Crear la cola y las trabajadoras
+ *
+ * @return false si faltó memoria (no queda nada creado)
+ */
+bool worker_pool_init(worker_pool_t *pool, const worker_pool_config_t *cfg);
+
+/**
+ * @brief Pedir a las trabajadoras que terminen (después de los trabajos ya
+ *        encolados), esperarlas y liberar la cola
+ */
+void worker_pool_stop(worker_pool_t *pool);
+
+/**
+ * @brief Encolar `fn(arg)`, esperando hasta `timeout` si la cola está llena
+ *
+ * @param future Inicializado con wp_future_init, o NULL si no interesa el resultado
+ * @return pdTRUE si se encoló
+ */
+BaseType_t worker_pool_submit(worker_pool_t *pool, wp_job_fn_t fn, void *arg,
+                              wp_future_t *future, TickType_t timeout);
+
+static inline void wp_future_init(wp_future_t *future)
+{
+  future->done = false;
+  future->result = NULL;
+  future->waiter = NULL;
+}
+
+/**
+ * @brief Esperar a que termine el trabajo del futuro
+ *
+ * Si vence, el futuro tiene que seguir existiendo hasta que el trabajo termine.
+ *
+ * @param result Si no es NULL recibe lo que devolvió el trabajo
+ * @return pdTRUE si terminó antes de `timeout`
+ */
+BaseType_t wp_future_wait(worker_pool_t *pool, wp_future_t *future, void **result, TickType_t timeout);
+
+void worker_pool_get_stats(worker_pool_t *pool, worker_pool_stats_t *stats);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar trabajos por segundo y latencia de inicio de una tarea
+ *        creada por trabajo contra el pool
+ */
+void worker_pool_benchmark(void);
+
+#endif // WORKER_POOL_H
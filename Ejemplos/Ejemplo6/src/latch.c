@@ -0,0 +1,115 @@
+/**
+ *
+ * Resumen:
+ * Implementación de la cuenta regresiva y la barrera cíclica (ver latch.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include "latch.h"
+
+#define LATCH_DONE_BIT    (1u << 0)
+
+// Bit de la vuelta `gen` de la barrera
+#define BARRIER_BIT(gen)  (1u << ((gen) & 1u))
+
+//*****************************************************************************
+// Cuenta regresiva
+
+void latch_init(latch_t *latch, uint32_t count)
+{
+  portMUX_INITIALIZE(&latch->mux);
+  latch->count = count;
+  latch->events = xEventGroupCreateStatic(&latch->events_buf);
+  if (count == 0) {
+    xEventGroupSetBits(latch->events, LATCH_DONE_BIT);
+  }
+}
+
+void latch_delete(latch_t *latch)
+{
+  vEventGroupDelete(latch->events);
+  latch->events = NULL;
+}
+
+void latch_count_down(latch_t *latch)
+{
+  bool done = false;
+
+  portENTER_CRITICAL(&latch->mux);
+  if (latch->count > 0) {
+    latch->count--;
+    done = (latch->count == 0);
+  }
+  portEXIT_CRITICAL(&latch->mux);
+
+  // Fuera de la sección crítica: puede despertar tareas
+  if (done) {
+    xEventGroupSetBits(latch->events, LATCH_DONE_BIT);
+  }
+}
+
+BaseType_t latch_wait(latch_t *latch, TickType_t timeout)
+{
+  EventBits_t bits = xEventGroupWaitBits(latch->events, LATCH_DONE_BIT, pdFALSE, pdTRUE, timeout);
+
+  return (bits & LATCH_DONE_BIT) ? pdTRUE : pdFALSE;
+}
+
+//*****************************************************************************
+// Barrera cíclica
+
+void barrier_init(barrier_t *barrier, uint32_t parties)
+{
+  portMUX_INITIALIZE(&barrier->mux);
+  barrier->parties = parties;
+  barrier->arrived = 0;
+  barrier->generation = 0;
+  barrier->events = xEventGroupCreateStatic(&barrier->events_buf);
+}
+
+void barrier_delete(barrier_t *barrier)
+{
+  vEventGroupDelete(barrier->events);
+  barrier->events = NULL;
+}
+
+BaseType_t barrier_wait(barrier_t *barrier, TickType_t timeout)
+{
+  uint32_t gen;
+  bool last;
+
+  portENTER_CRITICAL(&barrier->mux);
+  gen = barrier->generation;
+  barrier->arrived++;
+  last = (barrier->arrived == barrier->parties);
+  if (last) {
+    barrier->arrived = 0;
+    barrier->generation++;
+  }
+  portEXIT_CRITICAL(&barrier->mux);
+
+  if (last) {
+    // Preparar el bit de la vuelta siguiente antes de liberar esta. Nadie
+    // puede estar esperándolo: haría falta que esta tarea ya hubiera llegado.
+    xEventGroupClearBits(barrier->events, BARRIER_BIT(gen + 1));
+    xEventGroupSetBits(barrier->events, BARRIER_BIT(gen));
+    return pdTRUE;
+  }
+
+  EventBits_t bits = xEventGroupWaitBits(barrier->events, BARRIER_BIT(gen), pdFALSE, pdTRUE, timeout);
+  if (bits & BARRIER_BIT(gen)) {
+    return pdTRUE;
+  }
+
+  // Venció: dejar de contar, salvo que la vuelta se haya completado igual
+  portENTER_CRITICAL(&barrier->mux);
+  bool completed = (barrier->generation != gen);
+  if (!completed) {
+    barrier->arrived--;
+  }
+  portEXIT_CRITICAL(&barrier->mux);
+
+  return completed ? pdTRUE : pdFALSE;
+}
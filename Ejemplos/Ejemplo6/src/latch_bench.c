@@ -0,0 +1,148 @@
+/**
+ *
+ * Resumen:
+ * Medición del tiempo desde la largada hasta que app_main sabe que las N
+ * tareas están listas (como en myTask: copiar el parámetro y avisar), para
+ * N = 4 .. 48:
+ * - semáforo contador: cada tarea da el semáforo y se toman N veces;
+ * - latch: cada tarea llama a latch_count_down y se espera una sola vez.
+ * Después las mismas tareas dan BENCH_ROUNDS vueltas por una barrera cíclica
+ * y se informan las vueltas por segundo.
+ *
+ * Las tareas se crean antes y esperan en una compuerta (latch de cuenta 1),
+ * así la creación no entra en la medición.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "latch.h"
+
+// Configuración
+#define BENCH_ROUNDS      (200)     // Vueltas por la barrera
+#define BENCH_STACK       (1536)
+#define BENCH_PRIO        (5)
+
+#if CONFIG_FREERTOS_UNICORE
+  #define BENCH_APP_CPU   (0)
+#else
+  #define BENCH_APP_CPU   (1)
+#endif
+
+static const int task_counts[] = { 4, 8, 16, 32, 48 };
+
+typedef struct {
+  char body[20];
+  uint8_t len;
+} bench_param_t;
+
+static bench_param_t param = { "All your base", 13 };
+static volatile uint32_t checksum;
+static bool use_latch;
+static uint32_t rounds;
+static latch_t start_gate;
+static latch_t ready;
+static latch_t finished;
+static barrier_t barrier;
+static SemaphoreHandle_t sem_ready;
+
+static void benchParty(void *parameters)
+{
+  latch_wait(&start_gate, portMAX_DELAY);
+
+  // Copiar el parámetro y avisar que se leyó
+  bench_param_t p = *(bench_param_t *)parameters;
+  checksum += p.len;
+  if (use_latch) {
+    latch_count_down(&ready);
+  } else {
+    xSemaphoreGive(sem_ready);
+  }
+
+  for (uint32_t r = 0; r < rounds; r++) {
+    barrier_wait(&barrier, portMAX_DELAY);
+  }
+
+  latch_count_down(&finished);
+  vTaskDelete(NULL);
+}
+
+// Devuelve el tiempo hasta que todas están listas; `barrier_us` el de las vueltas
+static int64_t bench_run(int n, bool latch_mode, int64_t *barrier_us)
+{
+  int64_t t0, t_ready;
+
+  use_latch = latch_mode;
+  rounds = latch_mode ? BENCH_ROUNDS : 0;
+  latch_init(&start_gate, 1);
+
+  for (int i = 0; i < n; i++) {
+    if (xTaskCreatePinnedToCore(benchParty, "Parte", BENCH_STACK, &param, BENCH_PRIO, NULL,
+                                BENCH_APP_CPU) != pdPASS) {
+      printf("No se pudo crear la tarea %d\n", i);
+      n = i;
+      break;
+    }
+  }
+  // Las tareas usan el resto recién después de la compuerta: contar las que se crearon
+  latch_init(&ready, n);
+  latch_init(&finished, n);
+  barrier_init(&barrier, n);
+  sem_ready = xSemaphoreCreateCounting(n, 0);
+
+  // Dejar que todas lleguen a la compuerta
+  vTaskDelay(2);
+
+  t0 = esp_timer_get_time();
+  latch_count_down(&start_gate);
+  if (latch_mode) {
+    latch_wait(&ready, portMAX_DELAY);
+  } else {
+    for (int i = 0; i < n; i++) {
+      xSemaphoreTake(sem_ready, portMAX_DELAY);
+    }
+  }
+  t_ready = esp_timer_get_time() - t0;
+
+  latch_wait(&finished, portMAX_DELAY);
+  *barrier_us = esp_timer_get_time() - t0 - t_ready;
+
+  // Dejar que IDLE libere las tareas borradas
+  vTaskDelay(2);
+  latch_delete(&start_gate);
+  latch_delete(&ready);
+  latch_delete(&finished);
+  barrier_delete(&barrier);
+  vSemaphoreDelete(sem_ready);
+
+  return t_ready;
+}
+
+void latch_benchmark(void)
+{
+  UBaseType_t prio = uxTaskPriorityGet(NULL);
+  int64_t us_sem, us_latch, us_barrier;
+
+  // Por encima de las tareas: cada aviso que la despierta se nota
+  vTaskPrioritySet(NULL, BENCH_PRIO + 1);
+
+  printf("---Medición arranque de N tareas (semáforo contador contra latch)---\n");
+
+  for (size_t i = 0; i < sizeof(task_counts) / sizeof(task_counts[0]); i++) {
+    int n = task_counts[i];
+
+    us_sem = bench_run(n, false, &us_barrier);
+    us_latch = bench_run(n, true, &us_barrier);
+
+    printf("N = %2d | semáforo: %6lu us | latch: %6lu us | barrera: %7.0f vueltas/s\n",
+           n, (unsigned long)us_sem, (unsigned long)us_latch,
+           us_barrier ? (double)BENCH_ROUNDS * 1e6 / (double)us_barrier : 0.0);
+  }
+
+  vTaskPrioritySet(NULL, prio);
+}
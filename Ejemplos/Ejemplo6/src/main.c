@@ -3,6 +3,17 @@
  * Resumen:
  * Demuestra un semáforo contador creando varias tareas con los mismos
  * parámetros.
+ * Con STATIC_ALLOC_EN el semáforo y las tareas salen de una tabla
+ * declarativa (static_objs.h) con almacenamiento estático: no se usa el heap
+ * al iniciar. STATIC_BENCH_EN compara tiempo y heap contra la creación dinámica.
+ * Con MSG_POOL_EN el mensaje viaja en un búfer de msg_pool.h que las tareas
+ * leen sin copiarlo, con una referencia por tarea; la última lo devuelve al
+ * pool. MSG_POOL_BENCH_EN compara el envío por valor contra el envío sin copia.
+ * Con WORKER_POOL_EN cada mensaje es un trabajo para un pool de tareas
+ * persistentes (worker_pool.h) en lugar de una tarea nueva que se borra al
+ * terminar. WORKER_POOL_BENCH_EN compara las dos formas.
+ * Con LATCH_EN las tareas avisan con una cuenta regresiva (latch.h) y
+ * app_main se despierta una sola vez en lugar de tomar el semáforo N veces.
  * Documentacion: https://www.freertos.org/Documentation/02-Kernel/02-Kernel-features/02-Queues-mutexes-and-semaphores/03-Counting-semaphores
  * 
  * Configuración GPIO:
@@ -18,6 +29,42 @@
 
 #include "freertos/FreeRTOS.h"
 #include <string.h>
+#include "static_objs.h"
+#include "msg_pool.h"
+#include "worker_pool.h"
+#include "latch.h"
+#include "stack_prof.h"
+
+// Descomentar para crear las tareas y el semáforo con asignación estática
+//#define STATIC_ALLOC_EN
+
+// Descomentar (junto con STATIC_ALLOC_EN) para comparar contra la creación dinámica
+//#define STATIC_BENCH_EN
+
+// Descomentar para pasar el mensaje en un búfer del pool, sin copiarlo en cada tarea
+//#define MSG_POOL_EN
+
+// Descomentar para comparar mensajes por valor contra mensajes sin copia
+//#define MSG_POOL_BENCH_EN
+
+// Descomentar para repartir los mensajes como trabajos de un pool de tareas persistentes
+//#define WORKER_POOL_EN
+
+// Descomentar para comparar una tarea por trabajo contra el pool
+//#define WORKER_POOL_BENCH_EN
+
+// Descomentar para esperar a las tareas con una cuenta regresiva en lugar del semáforo contador
+//#define LATCH_EN
+
+// Descomentar para comparar el semáforo contador contra el latch y medir la barrera
+//#define LATCH_BENCH_EN
+
+// Descomentar para informar periódicamente el peor caso de pila de todas las tareas
+//#define STACK_PROF_EN
+
+#if defined(WORKER_POOL_EN) && defined(STATIC_ALLOC_EN)
+  #error "WORKER_POOL_EN reemplaza a las tareas de la tabla estática: usar uno solo"
+#endif
 
 // Definir el número de núcleo a utilizar
 #if CONFIG_FREERTOS_UNICORE
@@ -35,33 +82,150 @@ typedef struct Message {
   uint8_t len;
 } Message;
 
+#ifdef WORKER_POOL_EN
+// Pool de trabajadoras que atienden los mensajes (se configura en app_main)
+static worker_pool_t worker_pool;
+#endif
+
+#ifdef MSG_POOL_EN
+// Pool de mensajes: un búfer lo comparten todas las tareas
+static msg_pool_t msg_pool;
+MSG_POOL_STORAGE(msg_pool_mem, sizeof(Message), 2);
+#endif
+
+#ifdef STATIC_ALLOC_EN
+// Mensaje común (las tareas arrancan al crearse, tiene que existir antes)
+#ifdef MSG_POOL_EN
+static msg_buf_t *shared_buf;
+#define TASK_ARG shared_buf
+#else
+static Message shared_msg;
+#define TASK_ARG &shared_msg
+#endif
+
+// Tabla de objetos del kernel, en orden de creación (debe coincidir con num_tasks)
+#define OBJS(TASK, QUEUE, MUTEX, COUNTING, TIMER) \
+  COUNTING(sem_params, 5, 0) \
+  TASK(task_0, myTask, "Tarea 0", 1700, TASK_ARG, 1, app_cpu) \
+  TASK(task_1, myTask, "Tarea 1", 1700, TASK_ARG, 1, app_cpu) \
+  TASK(task_2, myTask, "Tarea 2", 1700, TASK_ARG, 1, app_cpu) \
+  TASK(task_3, myTask, "Tarea 3", 1700, TASK_ARG, 1, app_cpu) \
+  TASK(task_4, myTask, "Tarea 4", 1700, TASK_ARG, 1, app_cpu)
+
+// Handles (sem_params incluido) y almacenamiento estático
+STATIC_OBJS_DECLARE(OBJS)
+#else
 // Variables globales
 static SemaphoreHandle_t sem_params; // Cuenta regresiva cuando los parámetros son leídos
+#endif
+
+#ifdef LATCH_EN
+// Llega a 0 cuando todas las tareas leyeron el parámetro
+static latch_t params_read;
+#define PARAMS_READ()   latch_count_down(&params_read)
+#else
+#define PARAMS_READ()   xSemaphoreGive(sem_params)
+#endif
 
 //*****************************************************************************
 // Tareas
 
-void myTask(void *parameters) {
+// Leer el mensaje del parámetro, avisar que fue leído e imprimirlo
+static uint8_t readMessage(void *parameters) {
+
+#ifdef MSG_POOL_EN
+    // Leer el mensaje directamente del búfer compartido
+    msg_buf_t *buf = (msg_buf_t *)parameters;
+    const Message *msg = (const Message *)buf->data;
 
+    // Incrementar el semáforo para indicar que el parámetro ha sido leído
+    PARAMS_READ();
+
+    // Imprimir el contenido del mensaje y soltar la referencia de esta tarea
+    printf("Recibido: %s | len: %d \n", msg->body, msg->len);
+    uint8_t len = msg->len;
+    msg_buf_release(buf);
+    return len;
+#else
     // Copiar la estructura de mensaje desde el parámetro a una variable local
     Message msg = *(Message *)parameters;
 
     // Incrementar el semáforo para indicar que el parámetro ha sido leído
-    xSemaphoreGive(sem_params);
+    PARAMS_READ();
 
     // Imprimir el contenido del mensaje
     printf("Recibido: %s | len: %d \n", msg.body, msg.len);
+    return msg.len;
+#endif
+}
+
+void myTask(void *parameters) {
+
+    readMessage(parameters);
 
     // Esperar un momento y eliminarse a sí mismo
     vTaskDelay(1000 / portTICK_PERIOD_MS);
     vTaskDelete(NULL);
 }
 
+#ifdef WORKER_POOL_EN
+// El mismo trabajo que myTask, pero la trabajadora sigue viva al terminar
+static void *myJob(void *parameters) {
+    return (void *)(uintptr_t)readMessage(parameters);
+}
+#endif
+
+#ifdef STATIC_ALLOC_EN
+// Creación desde la tabla (después de definir las tareas)
+#ifdef STATIC_BENCH_EN
+STATIC_OBJS_BENCH_FN(OBJS, objs_create)
+#else
+STATIC_OBJS_CREATE_FN(OBJS, objs_create)
+#endif
+#endif
+
+#ifdef MSG_POOL_EN
+// Tomar un búfer, escribir el mensaje y dejar una referencia por tarea
+static msg_buf_t *make_shared_msg(const char *text) {
+    msg_buf_t *buf = msg_pool_get(&msg_pool, portMAX_DELAY);
+    Message *msg = (Message *)buf->data;
+
+    strcpy(msg->body, text);
+    msg->len = strlen(text);
+    buf->len = sizeof(Message);
+
+    // La referencia inicial es la de la primera tarea
+    msg_buf_retain(buf, num_tasks - 1);
+    return buf;
+}
+#endif
+
 //*****************************************************************************
 // Main (se ejecuta como su propia tarea con prioridad 1 en el núcleo 1)
 void app_main() {
+#ifdef STACK_PROF_EN
+    // Informe de pila de todas las tareas, también las del sistema (IDLE, Tmr Svc, esp_timer)
+    stack_prof_start(STACK_PROF_DEFAULT_PERIOD_MS, STACK_PROF_DEFAULT_MARGIN, 1, tskNO_AFFINITY);
+#endif
+
+#ifndef STATIC_ALLOC_EN
+#ifndef WORKER_POOL_EN
     char task_name[12];
+#endif
+    void *task_arg;
+#ifndef MSG_POOL_EN
     Message msg;
+#endif
+#endif
+#ifdef WORKER_POOL_EN
+    wp_future_t futures[num_tasks];
+    void *result;
+    worker_pool_config_t wp_cfg = {
+        .queue_len = num_tasks,
+        .stack_size = 2048,
+        .priority = 1,
+    };
+#endif
     char text[20] = "All your base";
     
     // Configurar Serial
@@ -71,13 +235,66 @@ void app_main() {
     vTaskDelay(1000 / portTICK_PERIOD_MS);
     printf("\n---Demostración de Semáforo Contador en FreeRTOS---\n");
 
+#ifdef MSG_POOL_BENCH_EN
+    msg_pool_benchmark();
+#endif
+
+#ifdef WORKER_POOL_BENCH_EN
+    worker_pool_benchmark();
+#endif
+
+#ifdef LATCH_BENCH_EN
+    latch_benchmark();
+#endif
+
+#ifdef LATCH_EN
+    // Antes de crear las tareas: avisan apenas arrancan
+    latch_init(&params_read, num_tasks);
+#endif
+
+#ifdef MSG_POOL_EN
+    msg_pool_init(&msg_pool, msg_pool_mem, sizeof(Message), 2);
+#endif
+
+#ifdef WORKER_POOL_EN
+    // Trabajadoras creadas una sola vez, en el núcleo de la aplicación
+    wp_cfg.workers_per_core[app_cpu] = 2;
+    if (!worker_pool_init(&worker_pool, &wp_cfg)) {
+        printf("No se pudo crear el pool de trabajadoras\n");
+    }
+#endif
+
+#ifdef STATIC_ALLOC_EN
+    // Mensaje común, después todos los objetos de la tabla sin tocar el heap
+#ifdef MSG_POOL_EN
+    shared_buf = make_shared_msg(text);
+#else
+    strcpy(shared_msg.body, text);
+    shared_msg.len = strlen(text);
+#endif
+    if (!objs_create()) {
+        printf("No se pudo crear uno de los objetos de la tabla\n");
+    }
+#else
     // Crear semáforos (inicializados en 0)
     sem_params = xSemaphoreCreateCounting(num_tasks, 0);
 
     // Crear mensaje para usar como argumento común para todas las tareas
+#ifdef MSG_POOL_EN
+    task_arg = make_shared_msg(text);
+#else
     strcpy(msg.body, text);
     msg.len = strlen(text);
+    task_arg = &msg;
+#endif
 
+#ifdef WORKER_POOL_EN
+    // Un trabajo por mensaje, con un futuro para saber cuándo terminó cada uno
+    for (int i = 0; i < num_tasks; i++) {
+        wp_future_init(&futures[i]);
+        worker_pool_submit(&worker_pool, myJob, task_arg, &futures[i], portMAX_DELAY);
+    }
+#else
     // Iniciar tareas
     for (int i = 0; i < num_tasks; i++) {
         // Generar una cadena de nombre única para la tarea
@@ -87,20 +304,34 @@ void app_main() {
         xTaskCreatePinnedToCore(myTask,
                                 task_name,
                                 1700,
-                                (void *)&msg,
+                                task_arg,
                                 1,
                                 NULL,
                                 app_cpu);
     }
+#endif
+#endif
 
     // Esperar a que todas las tareas lean la memoria compartida
+#ifdef LATCH_EN
+    latch_wait(&params_read, portMAX_DELAY);
+#else
     for (int i = 0; i < num_tasks; i++) {
         xSemaphoreTake(sem_params, portMAX_DELAY);
     }
+#endif
 
     // Notificar que todas las tareas han sido creadas
     printf("Todas las tareas han sido creadas\n");
 
+#ifdef WORKER_POOL_EN
+    // Esperar el resultado de cada trabajo (el largo del mensaje)
+    for (int i = 0; i < num_tasks; i++) {
+        wp_future_wait(&worker_pool, &futures[i], &result, portMAX_DELAY);
+        printf("Trabajo %d terminado, len: %d\n", i, (int)(uintptr_t)result);
+    }
+#endif
+
     while(1){
         // No hacer nada, pero permitir ceder a tareas de menor prioridad
         vTaskDelay(1000 / portTICK_PERIOD_MS);
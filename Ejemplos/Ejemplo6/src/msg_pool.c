@@ -0,0 +1,101 @@
+/**
+ *
+ * Resumen:
+ * Implementación de los mensajes sin copia (ver msg_pool.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include "msg_pool.h"
+
+bool msg_pool_init(msg_pool_t *pool, void *storage, uint32_t capacity, uint32_t num_bufs)
+{
+  pool->base = (uint8_t *)storage;
+  pool->block_size = MSG_POOL_BLOCK(capacity);
+  pool->capacity = capacity;
+  pool->num_bufs = num_bufs;
+  pool->used = 0;
+  pool->peak = 0;
+  pool->failed = 0;
+  portMUX_INITIALIZE(&pool->lock);
+
+  pool->free_sem = xSemaphoreCreateCountingStatic(num_bufs, num_bufs, &pool->free_sem_buf);
+  if (pool->free_sem == NULL) {
+    return false;
+  }
+
+  // Enlazar todos los búferes en orden
+  pool->free_list = NULL;
+  for (uint32_t i = num_bufs; i > 0; i--) {
+    msg_buf_t *buf = (msg_buf_t *)(pool->base + (i - 1) * pool->block_size);
+    buf->pool = pool;
+    buf->next = pool->free_list;
+    pool->free_list = buf;
+  }
+
+  return true;
+}
+
+msg_buf_t *msg_pool_get(msg_pool_t *pool, TickType_t timeout)
+{
+  msg_buf_t *buf;
+
+  // El semáforo garantiza que hay un búfer en la lista
+  if (xSemaphoreTake(pool->free_sem, timeout) != pdTRUE) {
+    portENTER_CRITICAL(&pool->lock);
+    pool->failed++;
+    portEXIT_CRITICAL(&pool->lock);
+    return NULL;
+  }
+
+  portENTER_CRITICAL(&pool->lock);
+  buf = pool->free_list;
+  pool->free_list = buf->next;
+  if (++pool->used > pool->peak) {
+    pool->peak = pool->used;
+  }
+  portEXIT_CRITICAL(&pool->lock);
+
+  atomic_store_explicit(&buf->refs, 1, memory_order_relaxed);
+  buf->len = 0;
+  return buf;
+}
+
+void msg_buf_release(msg_buf_t *buf)
+{
+  msg_pool_t *pool = buf->pool;
+
+  // Solo el último dueño lo devuelve; acq_rel ordena sus lecturas antes del reuso
+  if (atomic_fetch_sub_explicit(&buf->refs, 1, memory_order_acq_rel) != 1) {
+    return;
+  }
+
+  portENTER_CRITICAL(&pool->lock);
+  buf->next = pool->free_list;
+  pool->free_list = buf;
+  pool->used--;
+  portEXIT_CRITICAL(&pool->lock);
+
+  xSemaphoreGive(pool->free_sem);
+}
+
+uint32_t msg_publish(QueueHandle_t *queues, uint32_t num_queues, msg_buf_t *buf, TickType_t timeout)
+{
+  uint32_t sent = 0;
+
+  // Una referencia por cola antes de enviar: un consumidor rápido no puede liberarlo antes de tiempo
+  msg_buf_retain(buf, num_queues);
+
+  for (uint32_t i = 0; i < num_queues; i++) {
+    if (msg_send(queues[i], buf, timeout)) {
+      sent++;
+    } else {
+      msg_buf_release(buf);
+    }
+  }
+
+  // Soltar la referencia del productor
+  msg_buf_release(buf);
+  return sent;
+}
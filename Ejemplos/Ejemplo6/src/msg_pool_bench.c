@@ -0,0 +1,175 @@
+/**
+ *
+ * Resumen:
+ * Medición del caudal de mensajes por valor (xQueueSend copia el contenido
+ * al enviar y al recibir) contra el envío de punteros a búferes del pool,
+ * para varios tamaños de contenido, con el productor y los consumidores en
+ * núcleos distintos. En los dos casos el productor escribe todo el contenido
+ * y el consumidor lo verifica en el primer y el último byte.
+ *
+ * También se mide el reparto a BENCH_FANOUT consumidores: una copia por cola
+ * contra un solo búfer con contador de referencias.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "msg_pool.h"
+
+// Configuración
+#define BENCH_MSGS        (4000)    // Mensajes por prueba
+#define BENCH_DEPTH       (8)       // Largo de las colas
+#define BENCH_MAX_SIZE    (1024)
+#define BENCH_BUFS        (16)      // Búferes del pool
+#define BENCH_FANOUT      (3)
+#define BENCH_FANOUT_SIZE (256)
+
+#if CONFIG_FREERTOS_UNICORE
+  #define BENCH_CORE_TX   (0)
+  #define BENCH_CORE_RX   (0)
+#else
+  #define BENCH_CORE_TX   (0)
+  #define BENCH_CORE_RX   (1)
+#endif
+
+typedef struct {
+  bool zero_copy;
+  uint32_t size;
+  uint32_t fanout;
+  QueueHandle_t queues[BENCH_FANOUT];
+  uint32_t errors;
+} bench_ctx_t;
+
+static bench_ctx_t ctx;
+static msg_pool_t bench_pool;
+MSG_POOL_STORAGE(bench_pool_mem, BENCH_MAX_SIZE, BENCH_BUFS);
+static SemaphoreHandle_t done_sem;
+
+static void benchTx(void *parameters)
+{
+  static uint8_t payload[BENCH_MAX_SIZE];
+
+  for (uint32_t i = 0; i < BENCH_MSGS; i++) {
+    if (ctx.zero_copy) {
+      msg_buf_t *buf = msg_pool_get(&bench_pool, portMAX_DELAY);
+      memset(buf->data, (uint8_t)i, ctx.size);
+      buf->len = ctx.size;
+      if (ctx.fanout == 1) {
+        msg_send(ctx.queues[0], buf, portMAX_DELAY);
+      } else {
+        msg_publish(ctx.queues, ctx.fanout, buf, portMAX_DELAY);
+      }
+    } else {
+      memset(payload, (uint8_t)i, ctx.size);
+      for (uint32_t q = 0; q < ctx.fanout; q++) {
+        xQueueSend(ctx.queues[q], payload, portMAX_DELAY);
+      }
+    }
+  }
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static void benchRx(void *parameters)
+{
+  QueueHandle_t queue = (QueueHandle_t)parameters;
+  uint8_t *payload = NULL;
+
+  if (!ctx.zero_copy) {
+    payload = pvPortMalloc(ctx.size);
+  }
+
+  for (uint32_t i = 0; i < BENCH_MSGS; i++) {
+    const uint8_t *data;
+    msg_buf_t *buf = NULL;
+
+    if (ctx.zero_copy) {
+      buf = msg_recv(queue, portMAX_DELAY);
+      data = buf->data;
+    } else {
+      xQueueReceive(queue, payload, portMAX_DELAY);
+      data = payload;
+    }
+
+    if (data[0] != (uint8_t)i || data[ctx.size - 1] != (uint8_t)i) {
+      ctx.errors++;
+    }
+
+    if (buf != NULL) {
+      msg_buf_release(buf);
+    }
+  }
+
+  vPortFree(payload);
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static void bench_run(bool zero_copy, uint32_t size, uint32_t fanout)
+{
+  uint32_t item_size = zero_copy ? sizeof(msg_buf_t *) : size;
+
+  ctx.zero_copy = zero_copy;
+  ctx.size = size;
+  ctx.fanout = fanout;
+  ctx.errors = 0;
+  for (uint32_t q = 0; q < fanout; q++) {
+    ctx.queues[q] = xQueueCreate(BENCH_DEPTH, item_size);
+  }
+
+  int64_t t0 = esp_timer_get_time();
+  for (uint32_t q = 0; q < fanout; q++) {
+    xTaskCreatePinnedToCore(benchRx, "Rx", 2048, ctx.queues[q], 5, NULL, BENCH_CORE_RX);
+  }
+  xTaskCreatePinnedToCore(benchTx, "Tx", 2048, NULL, 5, NULL, BENCH_CORE_TX);
+  for (uint32_t i = 0; i < fanout + 1; i++) {
+    xSemaphoreTake(done_sem, portMAX_DELAY);
+  }
+  int64_t dt = esp_timer_get_time() - t0;
+
+  if (dt <= 0) {
+    dt = 1;
+  }
+  printf("%-9s | %4lu B x%lu | %8.0f msg/s | %6.2f MB/s%s\n",
+         zero_copy ? "sin copia" : "por valor", (unsigned long)size, (unsigned long)fanout,
+         (double)BENCH_MSGS * 1e6 / (double)dt,
+         (double)BENCH_MSGS * size * fanout / (double)dt,
+         ctx.errors ? "  (ERROR de contenido)" : "");
+
+  for (uint32_t q = 0; q < fanout; q++) {
+    vQueueDelete(ctx.queues[q]);
+  }
+}
+
+void msg_pool_benchmark(void)
+{
+  static const uint32_t sizes[] = { 16, 64, 256, 1024 };
+
+  msg_pool_init(&bench_pool, bench_pool_mem, BENCH_MAX_SIZE, BENCH_BUFS);
+  done_sem = xSemaphoreCreateCounting(BENCH_FANOUT + 1, 0);
+
+  printf("---Medición mensajes por valor vs sin copia (%d mensajes, cola de %d)---\n",
+         BENCH_MSGS, BENCH_DEPTH);
+
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    bench_run(false, sizes[s], 1);
+    bench_run(true, sizes[s], 1);
+  }
+
+  printf("---Reparto a %d consumidores---\n", BENCH_FANOUT);
+  bench_run(false, BENCH_FANOUT_SIZE, BENCH_FANOUT);
+  bench_run(true, BENCH_FANOUT_SIZE, BENCH_FANOUT);
+
+  printf("búferes en uso: %lu | pico: %lu de %d\n",
+         (unsigned long)bench_pool.used, (unsigned long)bench_pool.peak, BENCH_BUFS);
+
+  vSemaphoreDelete(done_sem);
+}
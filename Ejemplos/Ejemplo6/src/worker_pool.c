@@ -0,0 +1,182 @@
+/**
+ *
+ * Resumen:
+ * Implementación del pool de tareas trabajadoras (ver worker_pool.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include "esp_timer.h"
+#include "worker_pool.h"
+
+typedef struct {
+  wp_job_fn_t fn;                 // NULL: orden de terminar
+  void *arg;
+  wp_future_t *future;
+  int64_t t_submit;
+} wp_job_t;
+
+static void complete(worker_pool_t *pool, wp_future_t *future, void *result)
+{
+  TaskHandle_t wake;
+
+  portENTER_CRITICAL(&pool->mux);
+  future->result = result;
+  future->done = true;
+  wake = future->waiter;          // Después de esto el futuro puede dejar de existir
+  portEXIT_CRITICAL(&pool->mux);
+
+  if (wake != NULL) {
+    xTaskNotifyGive(wake);
+  }
+}
+
+static void poolWorker(void *parameters)
+{
+  worker_pool_t *pool = (worker_pool_t *)parameters;
+  wp_job_t job;
+
+  while (1) {
+    xQueueReceive(pool->jobs, &job, portMAX_DELAY);
+    if (job.fn == NULL) {
+      break;
+    }
+
+    uint32_t latency_us = (uint32_t)(esp_timer_get_time() - job.t_submit);
+    void *result = job.fn(job.arg);
+
+    portENTER_CRITICAL(&pool->mux);
+    pool->stats.done++;
+    pool->stats.latency_sum_us += latency_us;
+    if (latency_us > pool->stats.latency_max_us) {
+      pool->stats.latency_max_us = latency_us;
+    }
+    portEXIT_CRITICAL(&pool->mux);
+
+    if (job.future != NULL) {
+      complete(pool, job.future, result);
+    }
+  }
+
+  xSemaphoreGive(pool->exit_sem);
+  vTaskDelete(NULL);
+}
+
+bool worker_pool_init(worker_pool_t *pool, const worker_pool_config_t *cfg)
+{
+  char name[configMAX_TASK_NAME_LEN];
+
+  portMUX_INITIALIZE(&pool->mux);
+  pool->stats = (worker_pool_stats_t){ 0 };
+  pool->num_workers = 0;
+  pool->jobs = xQueueCreate(cfg->queue_len, sizeof(wp_job_t));
+  pool->exit_sem = xSemaphoreCreateCounting(WORKER_POOL_MAX, 0);
+  if (pool->jobs == NULL || pool->exit_sem == NULL) {
+    worker_pool_stop(pool);
+    return false;
+  }
+
+  for (int core = 0; core < portNUM_PROCESSORS; core++) {
+    for (int i = 0; i < cfg->workers_per_core[core]; i++) {
+      if (pool->num_workers == WORKER_POOL_MAX) {
+        worker_pool_stop(pool);
+        return false;
+      }
+      snprintf(name, sizeof(name), "WP%d.%d", core, i);
+      if (xTaskCreatePinnedToCore(poolWorker, name, cfg->stack_size, pool, cfg->priority,
+                                  &pool->workers[pool->num_workers], core) != pdPASS) {
+        worker_pool_stop(pool);
+        return false;
+      }
+      pool->num_workers++;
+    }
+  }
+
+  return true;
+}
+
+void worker_pool_stop(worker_pool_t *pool)
+{
+  wp_job_t stop = { 0 };
+
+  // Una orden por trabajadora, detrás de los trabajos ya encolados
+  for (uint32_t i = 0; i < pool->num_workers; i++) {
+    xQueueSend(pool->jobs, &stop, portMAX_DELAY);
+  }
+  for (uint32_t i = 0; i < pool->num_workers; i++) {
+    xSemaphoreTake(pool->exit_sem, portMAX_DELAY);
+  }
+  pool->num_workers = 0;
+
+  if (pool->jobs != NULL) {
+    vQueueDelete(pool->jobs);
+    pool->jobs = NULL;
+  }
+  if (pool->exit_sem != NULL) {
+    vSemaphoreDelete(pool->exit_sem);
+    pool->exit_sem = NULL;
+  }
+}
+
+BaseType_t worker_pool_submit(worker_pool_t *pool, wp_job_fn_t fn, void *arg,
+                              wp_future_t *future, TickType_t timeout)
+{
+  wp_job_t job = {
+    .fn = fn,
+    .arg = arg,
+    .future = future,
+    .t_submit = esp_timer_get_time(),
+  };
+
+  if (xQueueSend(pool->jobs, &job, timeout) != pdTRUE) {
+    portENTER_CRITICAL(&pool->mux);
+    pool->stats.rejected++;
+    portEXIT_CRITICAL(&pool->mux);
+    return pdFALSE;
+  }
+
+  portENTER_CRITICAL(&pool->mux);
+  pool->stats.submitted++;
+  portEXIT_CRITICAL(&pool->mux);
+  return pdTRUE;
+}
+
+BaseType_t wp_future_wait(worker_pool_t *pool, wp_future_t *future, void **result, TickType_t timeout)
+{
+  TimeOut_t to;
+
+  vTaskSetTimeOutState(&to);
+
+  while (1) {
+    bool expired = (xTaskCheckForTimeOut(&to, &timeout) != pdFALSE);
+
+    portENTER_CRITICAL(&pool->mux);
+    if (future->done) {
+      future->waiter = NULL;
+      portEXIT_CRITICAL(&pool->mux);
+      if (result != NULL) {
+        *result = future->result;
+      }
+      return pdTRUE;
+    }
+    if (expired) {
+      future->waiter = NULL;
+      portEXIT_CRITICAL(&pool->mux);
+      return pdFALSE;
+    }
+    future->waiter = xTaskGetCurrentTaskHandle();
+    portEXIT_CRITICAL(&pool->mux);
+
+    // Una notificación vieja solo produce una vuelta más
+    ulTaskNotifyTake(pdTRUE, timeout);
+  }
+}
+
+void worker_pool_get_stats(worker_pool_t *pool, worker_pool_stats_t *stats)
+{
+  portENTER_CRITICAL(&pool->mux);
+  *stats = pool->stats;
+  portEXIT_CRITICAL(&pool->mux);
+}
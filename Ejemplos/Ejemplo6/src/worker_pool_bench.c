@@ -0,0 +1,178 @@
+/**
+ *
+ * Resumen:
+ * Medición de trabajos por segundo y latencia de inicio (desde que se pide el
+ * trabajo hasta que empieza a correr) para:
+ * - una tarea creada por trabajo que se borra al terminar, como myTask;
+ * - el pool de trabajadoras, con hasta BENCH_INFLIGHT trabajos en vuelo;
+ * - el pool esperando el futuro de cada trabajo antes de enviar el siguiente.
+ *
+ * Cada trabajo calcula durante BENCH_WORK_US. Las tareas por trabajo se
+ * reparten entre los núcleos igual que las trabajadoras del pool.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "worker_pool.h"
+
+// Configuración
+#define BENCH_JOBS        (1000)
+#define BENCH_INFLIGHT    (4)       // Trabajos sin terminar como máximo
+#define BENCH_WORK_US     (50)
+#define BENCH_STACK       (2048)
+#define BENCH_PRIO        (5)       // Mayor que la del que envía
+
+#if CONFIG_FREERTOS_UNICORE
+  #define BENCH_CORES     (1)
+#else
+  #define BENCH_CORES     (2)
+#endif
+
+typedef enum {
+  METHOD_SPAWN,
+  METHOD_POOL,
+  METHOD_POOL_FUTURE,
+  METHOD_COUNT,
+} bench_method_t;
+
+static const char *const method_name[] = { "tarea por trabajo", "pool", "pool + futuro" };
+
+// Al enviar guarda el instante; el trabajo lo reemplaza por su latencia
+static int64_t t_job[BENCH_JOBS];
+static SemaphoreHandle_t done_sem;
+static uint32_t create_failed;
+
+static void *benchJob(void *arg)
+{
+  int64_t *t = (int64_t *)arg;
+  int64_t t0 = esp_timer_get_time();
+
+  *t = t0 - *t;
+  while (esp_timer_get_time() - t0 < BENCH_WORK_US) {
+  }
+
+  xSemaphoreGive(done_sem);
+  return arg;
+}
+
+static void benchSpawned(void *parameters)
+{
+  benchJob(parameters);
+  vTaskDelete(NULL);
+}
+
+static void bench_run(bench_method_t m, worker_pool_t *pool)
+{
+  wp_future_t future;
+  uint64_t lat_sum = 0;
+  uint32_t lat_max = 0;
+  size_t heap_min = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+
+  create_failed = 0;
+
+  int64_t t0 = esp_timer_get_time();
+  for (int i = 0; i < BENCH_JOBS; i++) {
+    if (m != METHOD_POOL_FUTURE && i >= BENCH_INFLIGHT) {
+      xSemaphoreTake(done_sem, portMAX_DELAY);
+    }
+
+    t_job[i] = esp_timer_get_time();
+    switch (m) {
+      case METHOD_SPAWN:
+        // Sin memoria hasta que IDLE libere las tareas borradas: reintentar
+        while (xTaskCreatePinnedToCore(benchSpawned, "Trabajo", BENCH_STACK, &t_job[i],
+                                       BENCH_PRIO, NULL, i % BENCH_CORES) != pdPASS) {
+          create_failed++;
+          vTaskDelay(1);
+        }
+        break;
+      case METHOD_POOL:
+        worker_pool_submit(pool, benchJob, &t_job[i], NULL, portMAX_DELAY);
+        break;
+      case METHOD_POOL_FUTURE:
+      default:
+        wp_future_init(&future);
+        worker_pool_submit(pool, benchJob, &t_job[i], &future, portMAX_DELAY);
+        wp_future_wait(pool, &future, NULL, portMAX_DELAY);
+        xSemaphoreTake(done_sem, portMAX_DELAY);
+        break;
+    }
+
+    size_t heap = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    if (heap < heap_min) {
+      heap_min = heap;
+    }
+  }
+  if (m != METHOD_POOL_FUTURE) {
+    for (int i = 0; i < BENCH_INFLIGHT; i++) {
+      xSemaphoreTake(done_sem, portMAX_DELAY);
+    }
+  }
+  int64_t dt = esp_timer_get_time() - t0;
+
+  for (int i = 0; i < BENCH_JOBS; i++) {
+    lat_sum += (uint64_t)t_job[i];
+    if ((uint32_t)t_job[i] > lat_max) {
+      lat_max = (uint32_t)t_job[i];
+    }
+  }
+
+  printf("%-18s | %7.0f trabajos/s | inicio medio: %6.1f us | máx: %6lu us | heap mín: %6u",
+         method_name[m], (double)BENCH_JOBS * 1e6 / (double)(dt ? dt : 1),
+         (double)lat_sum / BENCH_JOBS, (unsigned long)lat_max, (unsigned)heap_min);
+  if (create_failed) {
+    printf(" | creaciones fallidas: %lu", (unsigned long)create_failed);
+  }
+  printf("\n");
+
+  vTaskDelay(1);
+}
+
+void worker_pool_benchmark(void)
+{
+  worker_pool_t pool;
+  worker_pool_stats_t stats;
+  worker_pool_config_t cfg = {
+    .queue_len = BENCH_INFLIGHT,
+    .stack_size = BENCH_STACK,
+    .priority = BENCH_PRIO,
+  };
+  UBaseType_t prio = uxTaskPriorityGet(NULL);
+
+  // Una trabajadora por núcleo: el mismo paralelismo que las tareas por trabajo
+  for (int i = 0; i < BENCH_CORES; i++) {
+    cfg.workers_per_core[i] = 1;
+  }
+
+  // Por debajo de las tareas que ejecutan los trabajos
+  vTaskPrioritySet(NULL, BENCH_PRIO - 1);
+
+  done_sem = xSemaphoreCreateCounting(BENCH_JOBS, 0);
+
+  printf("---Medición de pool de tareas (%d trabajos de %d us, %d en vuelo)---\n",
+         BENCH_JOBS, BENCH_WORK_US, BENCH_INFLIGHT);
+
+  bench_run(METHOD_SPAWN, NULL);
+
+  if (!worker_pool_init(&pool, &cfg)) {
+    printf("No se pudo crear el pool\n");
+  } else {
+    bench_run(METHOD_POOL, &pool);
+    bench_run(METHOD_POOL_FUTURE, &pool);
+    worker_pool_get_stats(&pool, &stats);
+    printf("pool: %lu trabajos, %lu rechazados\n",
+           (unsigned long)stats.done, (unsigned long)stats.rejected);
+    worker_pool_stop(&pool);
+  }
+
+  vSemaphoreDelete(done_sem);
+
+  vTaskPrioritySet(NULL, prio);
+}
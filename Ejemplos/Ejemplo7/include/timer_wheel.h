@@ -0,0 +1,122 @@
+/**
+ *
+ * Resumen:
+ * Rueda de temporizadores jerárquica para miles de tiempos de espera (uno por
+ * conexión o sensor) que casi siempre se cancelan antes de vencer.
+ *
+ * - Armar y cancelar son O(1) y se hacen en el momento, con una sección
+ *   crítica corta: no pasan por la cola de comandos del daemon de
+ *   temporizadores (CONFIG_FREERTOS_TIMER_QUEUE_LENGTH), que se llena y
+ *   bloquea al que llama.
+ * - TW_LEVELS niveles de 64 ranuras: el nivel 0 tiene resolución de un tick
+ *   y cada nivel siguiente cubre 64 veces más; los temporizadores bajan de
+ *   nivel (cascada) al acercarse su vencimiento. Alcance: 2^24 ticks.
+ * - La cascada desprende la ranura con la sección crítica tomada y reubica
+ *   de a TW_CASCADE_BATCH temporizadores, soltándola entre lotes: una ranura
+ *   de nivel alto con miles no deja las interrupciones enmascaradas.
+ * - Una tarea de servicio avanza la rueda una vez por tick y ejecuta todos
+ *   los callbacks vencidos en ese tick en un solo despertar; con la rueda
+ *   vacía duerme hasta que se arme algo.
+ * - tw_start_from_isr arma desde una interrupción.
+ * - El temporizador (tw_timer_t) lo declara el usuario: no usa el heap.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define TW_LEVELS         (4)
+#define TW_SLOT_BITS      (6)
+#define TW_SLOTS          (1 << TW_SLOT_BITS)
+#define TW_CASCADE_BATCH  (16)      // Temporizadores reubicados por sección crítica
+
+struct tw_timer;
+
+typedef void (*tw_callback_t)(struct tw_timer *timer, void *arg);
+
+typedef struct tw_timer {
+  struct tw_timer *next;
+  struct tw_timer **pprev;        // NULL si no está armado
+  TickType_t expires;
+  TickType_t period;              // 0: una sola vez
+  tw_callback_t cb;
+  void *arg;
+} tw_timer_t;
+
+typedef struct {
+  uint32_t fired;
+  uint32_t max_batch;             // Callbacks en un mismo tick, como máximo
+  uint32_t max_late;              // Ticks de atraso de la tarea de servicio
+  uint32_t max_cascade;           // Temporizadores reubicados en una cascada, como máximo
+} tw_stats_t;
+
+typedef struct {
+  portMUX_TYPE mux;
+  TickType_t now;                 // Próximo tick a procesar
+  uint32_t active;                // Temporizadores armados
+  tw_timer_t *slots[TW_LEVELS][TW_SLOTS];
+  TaskHandle_t task;
+  tw_stats_t stats;
+} tw_wheel_t;
+
+/**
+ * @brief Iniciar la rueda y crear su tarea de servicio
+ *
+ * @param core Núcleo de la tarea, o tskNO_AFFINITY
+ * @return false si no se pudo crear la tarea
+ */
+bool tw_init(tw_wheel_t *wheel, UBaseType_t priority, uint32_t stack_size, BaseType_t core);
+
+static inline void tw_timer_init(tw_timer_t *timer, tw_callback_t cb, void *arg)
+{
+  timer->next = NULL;
+  timer->pprev = NULL;
+  timer->period = 0;
+  timer->cb = cb;
+  timer->arg = arg;
+}
+
+/**
+ * @brief Armar (o rearmar) para vencer en `delay` ticks y después cada
+ *        `period` ticks (0: una sola vez)
+ */
+void tw_start(tw_wheel_t *wheel, tw_timer_t *timer, TickType_t delay, TickType_t period);
+
+/**
+ * @brief Igual que tw_start, desde una ISR
+ */
+void tw_start_from_isr(tw_wheel_t *wheel, tw_timer_t *timer, TickType_t delay, TickType_t period,
+                       BaseType_t *higher_prio_woken);
+
+/**
+ * @brief Desarmar; después de volver el callback no se llama (salvo que ya
+ *        se esté ejecutando)
+ *
+ * @return true si estaba armado
+ */
+bool tw_cancel(tw_wheel_t *wheel, tw_timer_t *timer);
+
+static inline bool tw_is_armed(const tw_timer_t *timer)
+{
+  return timer->pprev != NULL;
+}
+
+void tw_get_stats(tw_wheel_t *wheel, tw_stats_t *stats);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar armado/cancelación por segundo y jitter de un periódico
+ *        contra el servicio de temporizadores de FreeRTOS
+ */
+void tw_benchmark(void);
+
+#endif // TIMER_WHEEL_H
@@ -2,6 +2,14 @@
  * 
  * Resumen:
  * Demuestra el uso básico de temporizadores de software.
+ * Con STATIC_ALLOC_EN los temporizadores salen de una tabla declarativa
+ * (static_objs.h) con bloques de control estáticos: no se usa el heap.
+ * STATIC_BENCH_EN compara tiempo y heap contra la creación dinámica.
+ * Con TIMER_WHEEL_EN los mismos dos temporizadores corren en una rueda de
+ * temporizadores (timer_wheel.h) que arma y cancela sin pasar por la cola del
+ * daemon. TW_BENCH_EN la compara contra el servicio de FreeRTOS.
+ * Con HR_TIMER_EN corren sobre hr_sched (esp_timer): períodos en
+ * microsegundos en lugar de ticks de 10 ms.
  * Documentacion: https://www.freertos.org/Documentation/02-Kernel/02-Kernel-features/05-Software-timers/01-Software-timers
  *
  * Configuración GPIO:
@@ -16,6 +24,36 @@
 //#include <timers.h>
 
 #include "freertos/FreeRTOS.h"
+#include "static_objs.h"
+#include "timer_wheel.h"
+#include "stack_prof.h"
+#include "hr_sched.h"
+
+// Descomentar para crear los temporizadores con asignación estática
+//#define STATIC_ALLOC_EN
+
+// Descomentar (junto con STATIC_ALLOC_EN) para comparar contra la creación dinámica
+//#define STATIC_BENCH_EN
+
+// Descomentar para usar la rueda de temporizadores en lugar del daemon de FreeRTOS
+//#define TIMER_WHEEL_EN
+
+// Descomentar para comparar la rueda contra los temporizadores de FreeRTOS al iniciar
+//#define TW_BENCH_EN
+
+// Descomentar para usar hr_sched (esp_timer) en lugar del daemon de FreeRTOS
+//#define HR_TIMER_EN
+
+// Descomentar para informar periódicamente el peor caso de pila de todas las tareas
+//#define STACK_PROF_EN
+
+#if defined(TIMER_WHEEL_EN) && defined(STATIC_ALLOC_EN)
+  #error "TIMER_WHEEL_EN no usa la tabla estática: usar uno solo"
+#endif
+
+#if defined(HR_TIMER_EN) && (defined(TIMER_WHEEL_EN) || defined(STATIC_ALLOC_EN))
+  #error "HR_TIMER_EN reemplaza a los temporizadores: no combinar con TIMER_WHEEL_EN ni STATIC_ALLOC_EN"
+#endif
 
 // Usar solo el núcleo 1 para propósitos de demostración
 // #if CONFIG_FREERTOS_UNICORE
@@ -24,31 +62,84 @@
 //   static const BaseType_t app_cpu = 1;
 // #endif
 
+#if defined(HR_TIMER_EN)
+// Planificador y eventos de alta resolución (los callbacks corren en la tarea de esp_timer)
+static hr_sched_t hr;
+static hr_event_t one_shot_timer;
+static hr_event_t auto_reload_timer;
+#elif defined(TIMER_WHEEL_EN)
+// Rueda y temporizadores (sin heap, salvo la pila de la tarea de servicio)
+static tw_wheel_t wheel;
+static tw_timer_t one_shot_timer;
+static tw_timer_t auto_reload_timer;
+#elif defined(STATIC_ALLOC_EN)
+// Tabla de objetos del kernel, en orden de creación
+#define OBJS(TASK, QUEUE, MUTEX, COUNTING, TIMER) \
+  TIMER(one_shot_timer, "Temporizador de una sola vez", 2000 / portTICK_PERIOD_MS, pdFALSE, (void *)0, myTimerCallback) \
+  TIMER(auto_reload_timer, "Temporizador de recarga automática", 1000 / portTICK_PERIOD_MS, pdTRUE, (void *)1, myTimerCallback)
+
+// Handles y almacenamiento estático
+STATIC_OBJS_DECLARE(OBJS)
+#else
 // Variables globales
 static TimerHandle_t one_shot_timer = NULL;
 static TimerHandle_t auto_reload_timer = NULL;
+#endif
 
 //*****************************************************************************
 // Callbacks
 
-// Llamado cuando uno de los temporizadores expira
-void myTimerCallback(TimerHandle_t xTimer) {
+// Mensaje común a todas las variantes de temporizador
+static void print_expired(uint32_t id) {
 
   // Imprimir mensaje si el temporizador 0 expira
-  if ((uint32_t)pvTimerGetTimerID(xTimer) == 0) {
+  if (id == 0) {
     printf("Temporizador de una sola vez expiró\n");
   }
 
   // Imprimir mensaje si el temporizador 1 expira
-  if ((uint32_t)pvTimerGetTimerID(xTimer) == 1) {
+  if (id == 1) {
     printf("Temporizador de recarga automática expiró\n");
   }
 }
 
+// Llamado cuando uno de los temporizadores expira
+void myTimerCallback(TimerHandle_t xTimer) {
+  print_expired((uint32_t)(uintptr_t)pvTimerGetTimerID(xTimer));
+}
+
+#ifdef TIMER_WHEEL_EN
+// Lo mismo para los temporizadores de la rueda (el ID viaja en `arg`)
+void myWheelCallback(tw_timer_t *timer, void *arg) {
+  print_expired((uint32_t)(uintptr_t)arg);
+}
+#endif
+
+#ifdef HR_TIMER_EN
+// Lo mismo para los eventos de hr_sched (el ID viaja en `arg`)
+void myHrCallback(hr_event_t *event, void *arg) {
+  print_expired((uint32_t)(uintptr_t)arg);
+}
+#endif
+
+#ifdef STATIC_ALLOC_EN
+// Creación desde la tabla (después de definir el callback)
+#ifdef STATIC_BENCH_EN
+STATIC_OBJS_BENCH_FN(OBJS, objs_create)
+#else
+STATIC_OBJS_CREATE_FN(OBJS, objs_create)
+#endif
+#endif
+
 //*****************************************************************************
 // Main (se ejecuta como su propia tarea con prioridad 1 en el núcleo 1)
 
 void app_main() {
+#ifdef STACK_PROF_EN
+    // Informe de pila de todas las tareas, también las del sistema (IDLE, Tmr Svc, esp_timer)
+    stack_prof_start(STACK_PROF_DEFAULT_PERIOD_MS, STACK_PROF_DEFAULT_MARGIN, 1, tskNO_AFFINITY);
+#endif
+
     // Configurar Serial
 
 
@@ -57,6 +148,46 @@ void app_main() {
     printf("\n");
     printf("---Demostración de Temporizador en FreeRTOS---\n");
 
+#ifdef TW_BENCH_EN
+    tw_benchmark();
+#endif
+
+#if defined(HR_TIMER_EN)
+    hr_event_init_cb(&one_shot_timer, myHrCallback, (void *)0);
+    hr_event_init_cb(&auto_reload_timer, myHrCallback, (void *)1);
+    if (!hr_sched_init(&hr)) {
+        printf("No se pudo iniciar hr_sched\n");
+    } else {
+
+        // Esperar y luego imprimir un mensaje de que estamos iniciando los temporizadores
+        vTaskDelay(1000 / portTICK_PERIOD_MS);
+        printf("Iniciando temporizadores...\n");
+
+        // Mismos períodos, en microsegundos
+        hr_start(&hr, &one_shot_timer, 2000000, 0);
+        hr_start(&hr, &auto_reload_timer, 1000000, 1000000);
+    }
+#elif defined(TIMER_WHEEL_EN)
+    // Misma prioridad que el daemon de temporizadores
+    tw_timer_init(&one_shot_timer, myWheelCallback, (void *)0);
+    tw_timer_init(&auto_reload_timer, myWheelCallback, (void *)1);
+    if (!tw_init(&wheel, configTIMER_TASK_PRIORITY, 3072, tskNO_AFFINITY)) {
+        printf("No se pudo crear la tarea de la rueda\n");
+    } else {
+
+        // Esperar y luego imprimir un mensaje de que estamos iniciando los temporizadores
+        vTaskDelay(1000 / portTICK_PERIOD_MS);
+        printf("Iniciando temporizadores...\n");
+
+        // Armar directamente, sin cola de comandos
+        tw_start(&wheel, &one_shot_timer, 2000 / portTICK_PERIOD_MS, 0);
+        tw_start(&wheel, &auto_reload_timer, 1000 / portTICK_PERIOD_MS, 1000 / portTICK_PERIOD_MS);
+    }
+#else
+#ifdef STATIC_ALLOC_EN
+    // Ambos temporizadores desde la tabla, sin tocar el heap
+    objs_create();
+#else
     // Crear un temporizador de una sola vez
     one_shot_timer = xTimerCreate(
                         "Temporizador de una sola vez",  // Nombre del temporizador
@@ -72,6 +203,7 @@ void app_main() {
                         pdTRUE,                               // Recarga automática
                         (void *)1,                            // ID del temporizador
                         myTimerCallback);                     // Función de callback
+#endif
 
     // Verificar que los temporizadores se hayan creado
     if (one_shot_timer == NULL || auto_reload_timer == NULL) {
@@ -86,6 +218,7 @@ void app_main() {
         xTimerStart(one_shot_timer, portMAX_DELAY);
         xTimerStart(auto_reload_timer, portMAX_DELAY);
     }
+#endif
 
     // Eliminar la tarea propia para demostrar que los temporizadores funcionarán sin tareas de usuario
     vTaskDelete(NULL);
@@ -0,0 +1,278 @@
+/**
+ *
+ * Resumen:
+ * Implementación de la rueda de temporizadores jerárquica (ver timer_wheel.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include "timer_wheel.h"
+
+#define TW_MASK           (TW_SLOTS - 1)
+#define TW_MAX_DELTA      ((TickType_t)1 << (TW_SLOT_BITS * TW_LEVELS))
+
+//*****************************************************************************
+// Listas (con la sección crítica tomada)
+
+static void tw_link(tw_timer_t **head, tw_timer_t *timer)
+{
+  timer->next = *head;
+  if (*head != NULL) {
+    (*head)->pprev = &timer->next;
+  }
+  *head = timer;
+  timer->pprev = head;
+}
+
+static void tw_unlink(tw_timer_t *timer)
+{
+  *timer->pprev = timer->next;
+  if (timer->next != NULL) {
+    timer->next->pprev = timer->pprev;
+  }
+  timer->next = NULL;
+  timer->pprev = NULL;
+}
+
+// Ubicar según lo que falta para vencer, relativo al próximo tick a procesar
+static void tw_insert(tw_wheel_t *wheel, tw_timer_t *timer)
+{
+  TickType_t delta = timer->expires - wheel->now;
+
+  if ((int32_t)delta < 0) {
+    // Ya vencido: en la ranura del próximo tick
+    tw_link(&wheel->slots[0][wheel->now & TW_MASK], timer);
+    return;
+  }
+  if (delta >= TW_MAX_DELTA) {
+    timer->expires = wheel->now + TW_MAX_DELTA - 1;
+    delta = TW_MAX_DELTA - 1;
+  }
+
+  int level = 0;
+  while (delta >= ((TickType_t)1 << (TW_SLOT_BITS * (level + 1)))) {
+    level++;
+  }
+  tw_link(&wheel->slots[level][(timer->expires >> (TW_SLOT_BITS * level)) & TW_MASK], timer);
+}
+
+// Armar con la sección crítica tomada; true si hay que despertar al servicio
+static bool tw_start_locked(tw_wheel_t *wheel, tw_timer_t *timer, TickType_t now_tick,
+                            TickType_t delay, TickType_t period)
+{
+  bool wake = false;
+
+  if (timer->pprev != NULL) {
+    tw_unlink(timer);
+  } else {
+    if (wheel->active == 0) {
+      // Rueda vacía: el servicio estaba dormido, adelantar sin recorrer ticks
+      wheel->now = now_tick;
+      wake = true;
+    }
+    wheel->active++;
+  }
+
+  timer->expires = now_tick + delay;
+  timer->period = period;
+  tw_insert(wheel, timer);
+
+  return wake;
+}
+
+//*****************************************************************************
+// Servicio
+
+// Bajar un nivel los temporizadores de la ranura que corresponde a `now`.
+// Se entra y se sale con la sección crítica tomada, pero se suelta cada
+// TW_CASCADE_BATCH temporizadores
+static void tw_cascade(tw_wheel_t *wheel)
+{
+  const TickType_t now = wheel->now;
+  uint32_t moved = 0;
+
+  for (int level = 1; level < TW_LEVELS; level++) {
+    uint32_t idx = (now >> (TW_SLOT_BITS * level)) & TW_MASK;
+    tw_timer_t *pending = wheel->slots[level][idx];
+
+    // Desprender la ranura a una lista local: mientras se reubica, cancelar
+    // o rearmar uno de ellos sigue siendo O(1)
+    wheel->slots[level][idx] = NULL;
+    if (pending != NULL) {
+      pending->pprev = &pending;
+    }
+
+    while (pending != NULL) {
+      tw_timer_t *timer = pending;
+
+      tw_unlink(timer);
+      tw_insert(wheel, timer);
+      if (++moved % TW_CASCADE_BATCH == 0) {
+        portEXIT_CRITICAL(&wheel->mux);
+        portENTER_CRITICAL(&wheel->mux);
+      }
+    }
+    if (idx != 0) {
+      break;
+    }
+  }
+
+  if (moved > wheel->stats.max_cascade) {
+    wheel->stats.max_cascade = moved;
+  }
+}
+
+// Procesar el tick `now`; false si ya se alcanzó `target`
+static bool tw_run_tick(tw_wheel_t *wheel, TickType_t target)
+{
+  tw_timer_t *expired;
+  uint32_t batch = 0;
+
+  portENTER_CRITICAL(&wheel->mux);
+  if ((int32_t)(target - wheel->now) < 0) {
+    portEXIT_CRITICAL(&wheel->mux);
+    return false;
+  }
+  if (target - wheel->now > wheel->stats.max_late) {
+    wheel->stats.max_late = target - wheel->now;
+  }
+
+  uint32_t idx = wheel->now & TW_MASK;
+  if (idx == 0) {
+    TickType_t now = wheel->now;
+
+    tw_cascade(wheel);
+    if (wheel->now != now) {
+      // Se canceló todo y se volvió a armar durante la cascada: la rueda se
+      // adelantó, empezar de nuevo con el tick actual
+      portEXIT_CRITICAL(&wheel->mux);
+      return true;
+    }
+  }
+
+  // Sacar la ranura entera a una lista local: un periódico rearmado no
+  // puede caer de nuevo en ella, y cancelar sigue siendo O(1)
+  expired = wheel->slots[0][idx];
+  wheel->slots[0][idx] = NULL;
+  if (expired != NULL) {
+    expired->pprev = &expired;
+  }
+  wheel->now++;
+
+  while (expired != NULL) {
+    tw_timer_t *timer = expired;
+
+    tw_unlink(timer);
+    if (timer->period != 0) {
+      timer->expires += timer->period;      // Sin deriva
+      tw_insert(wheel, timer);
+    } else {
+      wheel->active--;
+    }
+    tw_callback_t cb = timer->cb;
+    void *arg = timer->arg;
+    batch++;
+
+    // El callback puede armar o cancelar (también a sí mismo)
+    portEXIT_CRITICAL(&wheel->mux);
+    cb(timer, arg);
+    portENTER_CRITICAL(&wheel->mux);
+  }
+
+  wheel->stats.fired += batch;
+  if (batch > wheel->stats.max_batch) {
+    wheel->stats.max_batch = batch;
+  }
+  portEXIT_CRITICAL(&wheel->mux);
+
+  return true;
+}
+
+static void twService(void *parameters)
+{
+  tw_wheel_t *wheel = (tw_wheel_t *)parameters;
+  TickType_t last = xTaskGetTickCount();
+
+  while (1) {
+    if (wheel->active == 0) {
+      // Si se arma algo entre la lectura y la espera, la notificación queda pendiente
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      last = xTaskGetTickCount();
+    } else {
+      vTaskDelayUntil(&last, 1);
+    }
+
+    TickType_t target = xTaskGetTickCount();
+    while (tw_run_tick(wheel, target)) {
+    }
+  }
+}
+
+//*****************************************************************************
+// API
+
+bool tw_init(tw_wheel_t *wheel, UBaseType_t priority, uint32_t stack_size, BaseType_t core)
+{
+  portMUX_INITIALIZE(&wheel->mux);
+  wheel->now = xTaskGetTickCount();
+  wheel->active = 0;
+  wheel->stats = (tw_stats_t){ 0 };
+  for (int l = 0; l < TW_LEVELS; l++) {
+    for (int i = 0; i < TW_SLOTS; i++) {
+      wheel->slots[l][i] = NULL;
+    }
+  }
+
+  return xTaskCreatePinnedToCore(twService, "Rueda", stack_size, wheel, priority,
+                                 &wheel->task, core) == pdPASS;
+}
+
+void tw_start(tw_wheel_t *wheel, tw_timer_t *timer, TickType_t delay, TickType_t period)
+{
+  bool wake;
+
+  portENTER_CRITICAL(&wheel->mux);
+  wake = tw_start_locked(wheel, timer, xTaskGetTickCount(), delay, period);
+  portEXIT_CRITICAL(&wheel->mux);
+
+  if (wake) {
+    xTaskNotifyGive(wheel->task);
+  }
+}
+
+void tw_start_from_isr(tw_wheel_t *wheel, tw_timer_t *timer, TickType_t delay, TickType_t period,
+                       BaseType_t *higher_prio_woken)
+{
+  bool wake;
+
+  portENTER_CRITICAL_ISR(&wheel->mux);
+  wake = tw_start_locked(wheel, timer, xTaskGetTickCountFromISR(), delay, period);
+  portEXIT_CRITICAL_ISR(&wheel->mux);
+
+  if (wake) {
+    vTaskNotifyGiveFromISR(wheel->task, higher_prio_woken);
+  }
+}
+
+bool tw_cancel(tw_wheel_t *wheel, tw_timer_t *timer)
+{
+  bool armed;
+
+  portENTER_CRITICAL(&wheel->mux);
+  armed = (timer->pprev != NULL);
+  if (armed) {
+    tw_unlink(timer);
+    wheel->active--;
+  }
+  portEXIT_CRITICAL(&wheel->mux);
+
+  return armed;
+}
+
+void tw_get_stats(tw_wheel_t *wheel, tw_stats_t *stats)
+{
+  portENTER_CRITICAL(&wheel->mux);
+  *stats = wheel->stats;
+  portEXIT_CRITICAL(&wheel->mux);
+}
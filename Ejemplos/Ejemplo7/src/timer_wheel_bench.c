@@ -0,0 +1,200 @@
+/**
+ *
+ * Resumen:
+ * Medición de la rueda de temporizadores contra el servicio de temporizadores
+ * de FreeRTOS con BENCH_TIMERS temporizadores:
+ * - armado/cancelación: armar todos a 10 s y cancelarlos (el caso común de
+ *   un tiempo de espera que no vence). En FreeRTOS se cuenta hasta que el
+ *   daemon procesó el último comando de la cola.
+ * - jitter: un periódico de 1 tick mientras los BENCH_TIMERS vencen
+ *   repartidos en BENCH_RUN_TICKS ticks; se informa la desviación media y
+ *   máxima del intervalo entre llamadas respecto del tick. Los que vencen
+ *   después de 64 ticks pasan por una cascada del nivel 1: con miles de
+ *   temporizadores se ve que el periódico no se atrasa mientras se reubican.
+ * Con BENCH_TIMERS temporizadores de FreeRTOS el heap necesita unos
+ * 60 bytes por temporizador.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/timers.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "timer_wheel.h"
+
+// Configuración
+#define BENCH_TIMERS      (2000)
+#define BENCH_LONG_TICKS  (10000 / portTICK_PERIOD_MS)
+#define BENCH_RUN_TICKS   (100)
+
+static TimerHandle_t native[BENCH_TIMERS];
+static TimerHandle_t native_probe;
+static tw_wheel_t wheel;
+static tw_timer_t wheel_timers[BENCH_TIMERS];
+static tw_timer_t wheel_probe;
+static SemaphoreHandle_t done_sem;
+
+static volatile uint32_t load_fired;
+static int64_t stamps[BENCH_RUN_TICKS];
+static volatile uint32_t num_stamps;
+
+//*****************************************************************************
+// Callbacks
+
+static void native_load_cb(TimerHandle_t timer)
+{
+  load_fired++;
+}
+
+static void wheel_load_cb(tw_timer_t *timer, void *arg)
+{
+  load_fired++;
+}
+
+static void probe_stamp(void)
+{
+  if (num_stamps < BENCH_RUN_TICKS) {
+    stamps[num_stamps++] = esp_timer_get_time();
+  }
+}
+
+static void native_probe_cb(TimerHandle_t timer)
+{
+  probe_stamp();
+}
+
+static void wheel_probe_cb(tw_timer_t *timer, void *arg)
+{
+  probe_stamp();
+}
+
+// Corre en el daemon detrás de los comandos encolados antes
+static void native_drained(void *param, uint32_t value)
+{
+  xSemaphoreGive(done_sem);
+}
+
+//*****************************************************************************
+// Mediciones
+
+static void report_arm_cancel(const char *name, int64_t us)
+{
+  printf("%-10s | armar+cancelar: %8.0f op/s (%6.2f us/op)\n", name,
+         (double)2 * BENCH_TIMERS * 1e6 / (double)(us ? us : 1),
+         (double)us / (2 * BENCH_TIMERS));
+}
+
+static void report_jitter(const char *name)
+{
+  const int64_t tick_us = 1000000 / configTICK_RATE_HZ;
+  int64_t dev_max = 0;
+  int64_t dev_sum = 0;
+
+  for (uint32_t i = 1; i < num_stamps; i++) {
+    int64_t dev = llabs(stamps[i] - stamps[i - 1] - tick_us);
+    dev_sum += dev;
+    if (dev > dev_max) {
+      dev_max = dev;
+    }
+  }
+
+  printf("%-10s | jitter del periódico: medio %6.1f us, máx %6lu us | vencidos: %lu/%d\n", name,
+         num_stamps > 1 ? (double)dev_sum / (num_stamps - 1) : 0.0, (unsigned long)dev_max,
+         (unsigned long)load_fired, BENCH_TIMERS);
+}
+
+static void bench_native(void)
+{
+  int64_t t0;
+
+  // Arma y cancela, hasta que el daemon termina con la cola
+  t0 = esp_timer_get_time();
+  for (int i = 0; i < BENCH_TIMERS; i++) {
+    xTimerChangePeriod(native[i], BENCH_LONG_TICKS, portMAX_DELAY);
+  }
+  for (int i = 0; i < BENCH_TIMERS; i++) {
+    xTimerStop(native[i], portMAX_DELAY);
+  }
+  xTimerPendFunctionCall(native_drained, NULL, 0, portMAX_DELAY);
+  xSemaphoreTake(done_sem, portMAX_DELAY);
+  report_arm_cancel("FreeRTOS", esp_timer_get_time() - t0);
+
+  // Jitter con carga
+  load_fired = 0;
+  num_stamps = 0;
+  for (int i = 0; i < BENCH_TIMERS; i++) {
+    xTimerChangePeriod(native[i], 1 + i % BENCH_RUN_TICKS, portMAX_DELAY);
+  }
+  xTimerStart(native_probe, portMAX_DELAY);
+  vTaskDelay(BENCH_RUN_TICKS + 10);
+  xTimerStop(native_probe, portMAX_DELAY);
+  report_jitter("FreeRTOS");
+}
+
+static void bench_wheel(void)
+{
+  int64_t t0;
+  tw_stats_t stats;
+
+  t0 = esp_timer_get_time();
+  for (int i = 0; i < BENCH_TIMERS; i++) {
+    tw_start(&wheel, &wheel_timers[i], BENCH_LONG_TICKS, 0);
+  }
+  for (int i = 0; i < BENCH_TIMERS; i++) {
+    tw_cancel(&wheel, &wheel_timers[i]);
+  }
+  report_arm_cancel("rueda", esp_timer_get_time() - t0);
+
+  load_fired = 0;
+  num_stamps = 0;
+  for (int i = 0; i < BENCH_TIMERS; i++) {
+    tw_start(&wheel, &wheel_timers[i], 1 + i % BENCH_RUN_TICKS, 0);
+  }
+  tw_start(&wheel, &wheel_probe, 1, 1);
+  vTaskDelay(BENCH_RUN_TICKS + 10);
+  tw_cancel(&wheel, &wheel_probe);
+  report_jitter("rueda");
+
+  tw_get_stats(&wheel, &stats);
+  printf("rueda: %lu callbacks, hasta %lu en un tick, atraso máx %lu ticks, cascada máx %lu\n",
+         (unsigned long)stats.fired, (unsigned long)stats.max_batch, (unsigned long)stats.max_late,
+         (unsigned long)stats.max_cascade);
+}
+
+void tw_benchmark(void)
+{
+  done_sem = xSemaphoreCreateBinary();
+
+  for (int i = 0; i < BENCH_TIMERS; i++) {
+    native[i] = xTimerCreate("Carga", BENCH_LONG_TICKS, pdFALSE, NULL, native_load_cb);
+    tw_timer_init(&wheel_timers[i], wheel_load_cb, NULL);
+    if (native[i] == NULL) {
+      printf("No se pudo crear el temporizador %d\n", i);
+      return;
+    }
+  }
+  native_probe = xTimerCreate("Sonda", 1, pdTRUE, NULL, native_probe_cb);
+  tw_timer_init(&wheel_probe, wheel_probe_cb, NULL);
+
+  // Misma prioridad que el daemon de temporizadores
+  if (native_probe == NULL || !tw_init(&wheel, configTIMER_TASK_PRIORITY, 3072, tskNO_AFFINITY)) {
+    printf("No se pudo iniciar la medición\n");
+    return;
+  }
+
+  printf("---Medición rueda de temporizadores (%d temporizadores)---\n", BENCH_TIMERS);
+
+  bench_native();
+  bench_wheel();
+
+  // Liberar los temporizadores de FreeRTOS (la rueda y su tarea quedan, vacías)
+  for (int i = 0; i < BENCH_TIMERS; i++) {
+    xTimerDelete(native[i], portMAX_DELAY);
+  }
+  xTimerDelete(native_probe, portMAX_DELAY);
+}
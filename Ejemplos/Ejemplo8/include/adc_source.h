@@ -0,0 +1,76 @@
+/**
+ *
+ * Resumen:
+ * Interfaz de fuente de muestras de ADC para el modo de adquisición por bloques.
+ * Permite cambiar el ADC real (modo continuo con DMA) por un generador de
+ * formas de onda sintético sin modificar el resto de la cadena.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef ADC_SOURCE_H
+#define ADC_SOURCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
+#include "bench_clock.h"
+#define adc_now_us()      bench_now_us()
+
+// Fuente de muestras: llena un bloque completo por llamada
+typedef struct adc_source {
+  const char *name;
+  // Leer exactamente `len` muestras en `dst`, devuelve la cantidad leída.
+  // Si `wait_us` no es NULL se le suma el tiempo bloqueado esperando datos
+  // (DMA o ritmo simulado), para separarlo del costo de CPU de la conversión
+  size_t (*read_block)(void *ctx, int16_t *dst, size_t len, TickType_t timeout, uint32_t *wait_us);
+  void *ctx;
+} adc_source_t;
+
+//*****************************************************************************
+// Generador sintético (portable, no usa periféricos)
+
+typedef struct {
+  uint32_t phase;         // Acumulador de fase (32 bits = una vuelta)
+  uint32_t phase_inc;     // Incremento de fase por muestra
+  int16_t offset;         // Valor medio (cuentas de ADC)
+  int16_t amplitude;      // Amplitud pico (cuentas de ADC)
+  uint32_t noise;         // Estado del generador de ruido (LFSR)
+  int16_t noise_amp;      // Amplitud del ruido (0 = sin ruido)
+  uint32_t sample_rate;   // Hz, 0 = generar sin pausas (medir throughput)
+  uint32_t pending_us;    // Tiempo generado aún no esperado (ritmo real)
+} adc_synth_t;
+
+/**
+ * @brief Configurar una fuente senoidal sintética
+ *
+ * @param sample_rate Frecuencia de muestreo simulada (0 = tan rápido como sea posible)
+ * @param freq_hz     Frecuencia de la señal senoidal
+ */
+void adc_source_synth_init(adc_source_t *src, adc_synth_t *synth,
+                           uint32_t sample_rate, uint32_t freq_hz,
+                           int16_t offset, int16_t amplitude, int16_t noise_amp);
+
+//*****************************************************************************
+// ADC en modo continuo (DMA), solo en ESP32
+
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#include "esp_adc/adc_continuous.h"
+
+typedef struct {
+  adc_continuous_handle_t handle;
+  uint8_t raw[256];       // Trama cruda leída del driver
+  size_t raw_len;         // Bytes válidos en `raw`
+  size_t raw_pos;         // Próximo byte a convertir
+} adc_cont_t;
+
+/**
+ * @brief Iniciar el ADC1 en modo continuo sobre un canal
+ */
+esp_err_t adc_source_cont_init(adc_source_t *src, adc_cont_t *cont,
+                               adc_channel_t chan, uint32_t sample_rate);
+#endif
+
+#endif // ADC_SOURCE_H
@@ -0,0 +1,70 @@
+/**
+ *
+ * Resumen:
+ * Adquisición continua por bloques con doble buffer (ping-pong).
+ * Una tarea de adquisición llena un bloque desde la fuente (adc_source_t)
+ * mientras el consumidor procesa el otro; solo se sincroniza una vez por bloque.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef ADC_STREAM_H
+#define ADC_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "adc_source.h"
+
+#define ADC_STREAM_NUM_BUFS   (2)   // Ping-pong
+
+typedef struct {
+  uint32_t blocks_done;                   // Bloques entregados al consumidor
+  uint32_t blocks_dropped;                // Bloques descartados por falta de buffer libre
+  uint64_t work_us;                       // CPU en read_block, sin las esperas de datos
+} adc_stream_stats_t;
+
+typedef struct {
+  const adc_source_t *src;
+  size_t block_len;                       // Muestras por bloque
+  int16_t *bufs[ADC_STREAM_NUM_BUFS];
+  int16_t *scratch;                       // Destino cuando el consumidor se atrasa
+  QueueHandle_t free_q;                   // Bloques libres para llenar
+  QueueHandle_t ready_q;                  // Bloques llenos para consumir
+  TaskHandle_t task;
+
+  // Estadísticas: las escribe la tarea de adquisición, se leen con adc_stream_get_stats
+  portMUX_TYPE mux;
+  adc_stream_stats_t stats;
+} adc_stream_t;
+
+/**
+ * @brief Reservar los buffers e iniciar la tarea de adquisición
+ *
+ * @param block_len Tamaño de bloque configurable (muestras)
+ * @return pdPASS o pdFAIL si no hay memoria
+ */
+BaseType_t adc_stream_start(adc_stream_t *stream, const adc_source_t *src,
+                            size_t block_len, UBaseType_t priority, BaseType_t core);
+
+/**
+ * @brief Esperar el próximo bloque lleno (consumidor)
+ *
+ * @return Puntero al bloque o NULL si se agotó el timeout
+ */
+const int16_t *adc_stream_get_block(adc_stream_t *stream, TickType_t timeout);
+
+/**
+ * @brief Devolver un bloque ya procesado para que vuelva a llenarse
+ */
+void adc_stream_release_block(adc_stream_t *stream, const int16_t *block);
+
+/**
+ * @brief Copia consistente de las estadísticas (los 64 bits no se leen de
+ *        una sola vez)
+ */
+void adc_stream_get_stats(adc_stream_t *stream, adc_stream_stats_t *stats);
+
+#endif // ADC_STREAM_H
@@ -0,0 +1,91 @@
+/**
+ *
+ * Resumen:
+ * Etapa de procesamiento en punto fijo sobre bloques de muestras:
+ * promedio móvil, FIR con decimación y estadísticas (mín/máx/media/RMS).
+ *
+ * - Los núcleos trabajan sobre bloques completos con bucles simples, sin
+ *   índices circulares, para que el compilador pueda vectorizarlos.
+ * - Cada núcleo tiene una versión escalar de referencia (sufijo _ref) que
+ *   procesa muestra por muestra y sirve para verificar los resultados.
+ * - Coeficientes en Q15, acumuladores de 32 bits.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef DSP_H
+#define DSP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define DSP_MAX_BLOCK       (512)   // Tramo que procesa el FIR de una vez (bloques mayores, por tramos)
+#define DSP_MAVG_MAX_LOG2   (6)     // Ventana máxima del promedio móvil: 64
+#define DSP_FIR_MAX_TAPS    (64)
+
+//*****************************************************************************
+// Promedio móvil (ventana potencia de 2)
+
+typedef struct {
+  uint8_t log2_len;                             // Ventana = 1 << log2_len
+  int32_t sum;                                  // Suma de la ventana actual
+  int16_t hist[1 << DSP_MAVG_MAX_LOG2];         // Últimas muestras del bloque anterior
+} dsp_mavg_t;
+
+void dsp_mavg_init(dsp_mavg_t *st, uint8_t log2_len);
+void dsp_mavg(dsp_mavg_t *st, const int16_t *in, int16_t *out, size_t n);
+void dsp_mavg_ref(dsp_mavg_t *st, const int16_t *in, int16_t *out, size_t n);
+
+//*****************************************************************************
+// FIR con decimación
+
+typedef struct {
+  const int16_t *coef;                          // Coeficientes Q15 (taps)
+  size_t taps;
+  size_t decim;                                 // Factor de decimación
+  size_t phase;                                 // Índice de la próxima salida en el bloque siguiente
+  int16_t rcoef[DSP_FIR_MAX_TAPS];              // Coeficientes invertidos (recorrido hacia adelante)
+  // Historia (taps-1 muestras) seguida del bloque actual, fuera de la pila de la tarea
+  int16_t work[DSP_FIR_MAX_TAPS - 1 + DSP_MAX_BLOCK];
+} dsp_fir_t;
+
+/**
+ * @brief Diseñar un pasa bajos por ventana de Hamming en Q15
+ *
+ * @param cutoff Frecuencia de corte normalizada (0..0.5 de la frecuencia de muestreo)
+ */
+void dsp_fir_design_lowpass(int16_t *coef, size_t taps, float cutoff);
+
+void dsp_fir_init(dsp_fir_t *st, const int16_t *coef, size_t taps, size_t decim);
+
+/**
+ * `n` puede superar DSP_MAX_BLOCK: el bloque se procesa por tramos.
+ *
+ * @return Cantidad de muestras escritas en `out` (aprox. n / decim)
+ */
+size_t dsp_fir_decim(dsp_fir_t *st, const int16_t *in, int16_t *out, size_t n);
+size_t dsp_fir_decim_ref(dsp_fir_t *st, const int16_t *in, int16_t *out, size_t n);
+
+//*****************************************************************************
+// Estadísticas de bloque
+
+typedef struct {
+  int16_t min;
+  int16_t max;
+  int16_t mean;
+  uint16_t rms;
+} dsp_stats_t;
+
+void dsp_stats(const int16_t *in, size_t n, dsp_stats_t *out);
+void dsp_stats_ref(const int16_t *in, size_t n, dsp_stats_t *out);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Verificar cada núcleo contra su referencia e imprimir muestras/s
+ */
+void dsp_benchmark(void);
+
+#endif // DSP_H
@@ -0,0 +1,58 @@
+/**
+ *
+ * Resumen:
+ * Instrumentación de latencia ISR -> tarea con histogramas log2.
+ * Cada camino medido (lat_path_t) acumula cantidad, suma, máximo y un
+ * histograma donde el casillero k cuenta latencias en [2^(k-1), 2^k) ticks.
+ *
+ * - En ESP32 el tick es el contador de ciclos de la CPU (esp_cpu_get_cycle_count).
+ *   Cada núcleo tiene su propio contador: el inicio y el fin de un camino deben
+ *   tomarse en el mismo núcleo.
+ * - En host se usa clock_gettime(CLOCK_MONOTONIC) y el tick es 1 ns.
+ * - lat_record() es apta para ISR; lat_dump() imprime la tabla de resultados.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define LAT_HIST_BUCKETS    (32)
+
+#include "bench_clock.h"
+#define LAT_TICKS_PER_US    BENCH_TICKS_PER_US
+#define lat_now()           bench_ticks()
+
+// Estadísticas de un camino
+typedef struct {
+  const char *name;
+  uint32_t count;
+  uint32_t max;
+  uint64_t sum;
+  uint32_t hist[LAT_HIST_BUCKETS];
+} lat_path_t;
+
+#define LAT_PATH_INIT(n)    { .name = (n) }
+
+/**
+ * @brief Registrar una latencia entre dos marcas de lat_now() (apta para ISR)
+ */
+void lat_record(lat_path_t *path, uint32_t start, uint32_t end);
+
+/**
+ * @brief Registrar un valor ya calculado en ticks (por ejemplo, un desvío de período)
+ */
+void lat_record_value(lat_path_t *path, uint32_t ticks);
+
+void lat_reset(lat_path_t *path);
+
+/**
+ * @brief Imprimir cantidad, media, máximo e histograma (en us) de varios caminos
+ */
+void lat_dump(lat_path_t *paths, size_t n);
+
+#endif // LATENCY_H
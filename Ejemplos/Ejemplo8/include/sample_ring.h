@@ -0,0 +1,83 @@
+/**
+ *
+ * Resumen:
+ * Buffer circular lock-free de un productor y un consumidor (SPSC) para pasar
+ * muestras de ADC desde la ISR hacia una tarea sin perder valores.
+ *
+ * - El productor (ISR) solo escribe `head`, el consumidor (tarea) solo escribe `tail`.
+ * - La capacidad debe ser potencia de 2 para reemplazar el módulo por una máscara.
+ * - Si el buffer está lleno la muestra nueva se descarta y se cuenta en `overruns`.
+ * - Opcionalmente guarda la marca de tiempo de cada muestra (tomada en la
+ *   ISR), para informar el instante real y no uno deducido del índice.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+// Estructura del buffer circular
+typedef struct {
+  int16_t *buf;               // Almacenamiento provisto por el usuario
+  int64_t *stamps;            // Marcas de tiempo (opcional, NULL si no se usan)
+  uint32_t mask;              // capacidad - 1
+  atomic_uint_fast32_t head;  // Índice de escritura (solo productor)
+  atomic_uint_fast32_t tail;  // Índice de lectura (solo consumidor)
+  uint32_t pushed;            // Muestras aceptadas (productor)
+  uint32_t overruns;          // Muestras descartadas por buffer lleno (productor)
+  uint32_t high_water;        // Máxima ocupación observada (productor)
+} sample_ring_t;
+
+/**
+ * @brief Inicializar el buffer sobre un almacenamiento estático
+ *
+ * @return false si la capacidad no es potencia de 2
+ */
+bool sample_ring_init(sample_ring_t *ring, int16_t *storage, size_t capacity);
+
+/**
+ * @brief Igual que sample_ring_init, con lugar para una marca por muestra
+ *
+ * @param stamps Almacenamiento de `capacity` marcas
+ */
+bool sample_ring_init_stamped(sample_ring_t *ring, int16_t *storage, int64_t *stamps, size_t capacity);
+
+/**
+ * @brief Agregar una muestra (solo productor, apto para ISR)
+ *
+ * @return false si el buffer estaba lleno y la muestra se descartó
+ */
+bool sample_ring_push(sample_ring_t *ring, int16_t sample);
+
+/**
+ * @brief Agregar una muestra con su marca de tiempo (se ignora si el buffer
+ *        no tiene marcas)
+ */
+bool sample_ring_push_stamped(sample_ring_t *ring, int16_t sample, int64_t t_us);
+
+/**
+ * @brief Extraer hasta `max` muestras en lote (solo consumidor)
+ *
+ * @return Cantidad de muestras copiadas en `dst`
+ */
+size_t sample_ring_pop_n(sample_ring_t *ring, int16_t *dst, size_t max);
+
+/**
+ * @brief Extraer hasta `max` muestras y sus marcas de tiempo (solo consumidor)
+ *
+ * @param dst_stamps Destino de las marcas, o NULL
+ */
+size_t sample_ring_pop_n_stamped(sample_ring_t *ring, int16_t *dst, int64_t *dst_stamps, size_t max);
+
+/**
+ * @brief Cantidad de muestras pendientes de leer
+ */
+size_t sample_ring_count(sample_ring_t *ring);
+
+#endif // SAMPLE_RING_H
@@ -0,0 +1,19 @@
+/**
+ *
+ * Resumen:
+ * Medición de la telemetría binaria del componente telemetry contra un
+ * printf por muestra. Es propia del Ejemplo8 porque usa su fuente de ADC.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef TELEMETRY_BENCH_H
+#define TELEMETRY_BENCH_H
+
+/**
+ * @brief Comparar bytes y CPU por muestra contra printf("%d\n")
+ */
+void telem_benchmark(void);
+
+#endif // TELEMETRY_BENCH_H
@@ -0,0 +1,134 @@
+/**
+ *
+ * Resumen:
+ * Ejecutor de trabajos con robo de trabajo: una trabajadora por núcleo, cada
+ * una con su propia cola doble (deque), para usar los dos núcleos del ESP32
+ * en lugar de fijar todo el procesamiento a app_cpu.
+ *
+ * - La dueña saca trabajos del fondo de su deque (el último encolado, con
+ *   los datos todavía en caché); una trabajadora sin trabajo roba del frente
+ *   de la deque del otro núcleo (el más viejo).
+ * - Cada deque es un anillo de largo fijo protegido por su propio portMUX:
+ *   las secciones son de pocas instrucciones y no hay memoria dinámica.
+ * - Afinidad por trabajo: WS_ANY va a la deque del núcleo que lo envía,
+ *   WS_PREFER(core) a la de ese núcleo pero se puede robar (datos en su
+ *   caché) y WS_PIN(core) solo corre en ese núcleo (periférico o ISR
+ *   instalada ahí).
+ * - Grupos para esperar un conjunto de trabajos y ws_parallel_for para
+ *   repartir un rango [begin, end) en trozos de `grain` elementos.
+ * - Las trabajadoras sin trabajo duermen en una notificación de tarea
+ *   (índice 0) y se despiertan al encolar algo que pueden tomar.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef WS_EXEC_H
+#define WS_EXEC_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define WS_DEQUE_LEN      (64)      // Trabajos por núcleo (potencia de 2)
+
+typedef void (*ws_job_fn_t)(void *arg);
+typedef void (*ws_range_fn_t)(void *ctx, size_t lo, size_t hi);
+
+typedef struct {
+  int8_t core;                    // -1: el núcleo que envía
+  bool pinned;                    // No se puede robar
+} ws_hint_t;
+
+#define WS_ANY            ((ws_hint_t){ -1, false })
+#define WS_PREFER(c)      ((ws_hint_t){ (c), false })
+#define WS_PIN(c)         ((ws_hint_t){ (c), true })
+
+// Conjunto de trabajos a esperar (puede vivir en la pila del que espera)
+typedef struct {
+  portMUX_TYPE mux;
+  uint32_t pending;
+  TaskHandle_t waiter;
+} ws_group_t;
+
+typedef struct {
+  ws_job_fn_t fn;
+  ws_range_fn_t range_fn;         // Si no es NULL se llama con [lo, hi)
+  void *arg;
+  size_t lo;
+  size_t hi;
+  ws_group_t *group;
+  bool pinned;
+} ws_job_t;
+
+typedef struct {
+  portMUX_TYPE mux;
+  uint32_t head;                  // Frente: roban las otras trabajadoras
+  uint32_t tail;                  // Fondo: saca la dueña
+  ws_job_t jobs[WS_DEQUE_LEN];
+  TaskHandle_t worker;
+  _Atomic bool idle;              // Durmiendo o por dormir
+  uint32_t executed;
+  uint32_t stolen;                // Trabajos que esta trabajadora robó
+} __attribute__((aligned(32))) ws_core_t;
+
+typedef struct {
+  ws_core_t core[portNUM_PROCESSORS];
+  volatile bool running;
+  _Atomic uint32_t alive;         // Trabajadoras que todavía no salieron
+} ws_exec_t;
+
+/**
+ * @brief Crear una trabajadora fijada a cada núcleo
+ *
+ * @return false si no se pudo crear alguna (no queda ninguna corriendo)
+ */
+bool ws_exec_init(ws_exec_t *ex, UBaseType_t priority, uint32_t stack_size);
+
+/**
+ * @brief Detener las trabajadoras después de vaciar las deques
+ */
+void ws_exec_stop(ws_exec_t *ex);
+
+/**
+ * @brief Encolar `fn(arg)` según la afinidad `hint`
+ *
+ * @param group Sumado al grupo antes de encolar, o NULL
+ * @return false si la deque elegida está llena
+ */
+bool ws_submit(ws_exec_t *ex, ws_job_fn_t fn, void *arg, ws_hint_t hint, ws_group_t *group);
+
+static inline void ws_group_init(ws_group_t *group)
+{
+  portMUX_INITIALIZE(&group->mux);
+  group->pending = 0;
+  group->waiter = NULL;
+}
+
+/**
+ * @brief Esperar a que terminen todos los trabajos del grupo (una tarea a la vez)
+ */
+void ws_group_wait(ws_group_t *group);
+
+/**
+ * @brief Ejecutar fn(ctx, lo, hi) sobre [begin, end) en trozos de `grain`,
+ *        repartidos entre los núcleos, y esperar a que terminen
+ *
+ * Los trozos que no entran en las deques los ejecuta el que llama.
+ */
+void ws_parallel_for(ws_exec_t *ex, size_t begin, size_t end, size_t grain,
+                     ws_range_fn_t fn, void *ctx);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar el filtrado de varios canales en una sola tarea fijada a
+ *        app_cpu contra ws_parallel_for en los dos núcleos
+ */
+void ws_exec_benchmark(void);
+
+#endif // WS_EXEC_H
@@ -0,0 +1,87 @@
+/**
+ *
+ * Resumen:
+ * Fuente de muestras con el ADC1 en modo continuo (DMA). El hardware muestrea
+ * a la frecuencia configurada y el driver entrega tramas que se convierten
+ * a muestras de 16 bits bloque por bloque, sin una interrupción por muestra.
+ * Documentacion: https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/adc_continuous.html
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <string.h>
+#include "adc_source.h"
+
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+
+#include "esp_err.h"
+
+static size_t cont_read_block(void *ctx, int16_t *dst, size_t len, TickType_t timeout, uint32_t *wait_us)
+{
+  adc_cont_t *c = (adc_cont_t *)ctx;
+  size_t n = 0;
+
+  while (n < len) {
+    // Pedir una trama nueva cuando se consumió la anterior
+    if (c->raw_pos >= c->raw_len) {
+      uint32_t got = 0;
+      uint32_t timeout_ms = (timeout == portMAX_DELAY) ? ADC_MAX_DELAY : timeout * portTICK_PERIOD_MS;
+      uint64_t t0 = adc_now_us();
+      esp_err_t ret = adc_continuous_read(c->handle, c->raw, sizeof(c->raw), &got, timeout_ms);
+      if (wait_us != NULL) {
+        *wait_us += (uint32_t)(adc_now_us() - t0);
+      }
+      if (ret != ESP_OK) {
+        break;
+      }
+      c->raw_len = got;
+      c->raw_pos = 0;
+    }
+
+    // Convertir los resultados crudos (formato TYPE1 en ESP32)
+    while (c->raw_pos + SOC_ADC_DIGI_RESULT_BYTES <= c->raw_len && n < len) {
+      adc_digi_output_data_t *p = (adc_digi_output_data_t *)&c->raw[c->raw_pos];
+      dst[n++] = (int16_t)p->type1.data;
+      c->raw_pos += SOC_ADC_DIGI_RESULT_BYTES;
+    }
+  }
+
+  return n;
+}
+
+esp_err_t adc_source_cont_init(adc_source_t *src, adc_cont_t *cont,
+                               adc_channel_t chan, uint32_t sample_rate)
+{
+  adc_continuous_handle_cfg_t handle_cfg = {
+    .max_store_buf_size = 4 * sizeof(cont->raw),
+    .conv_frame_size = sizeof(cont->raw),
+  };
+  ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_cfg, &cont->handle));
+
+  adc_digi_pattern_config_t pattern = {
+    .atten = ADC_ATTEN_DB_12,
+    .channel = chan,
+    .unit = ADC_UNIT_1,
+    .bit_width = SOC_ADC_DIGI_MAX_BITWIDTH,
+  };
+  adc_continuous_config_t dig_cfg = {
+    .sample_freq_hz = sample_rate,
+    .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+    .format = ADC_DIGI_OUTPUT_FORMAT_TYPE1,
+    .pattern_num = 1,
+    .adc_pattern = &pattern,
+  };
+  ESP_ERROR_CHECK(adc_continuous_config(cont->handle, &dig_cfg));
+
+  cont->raw_len = 0;
+  cont->raw_pos = 0;
+
+  src->name = "adc continuo";
+  src->read_block = cont_read_block;
+  src->ctx = cont;
+
+  return adc_continuous_start(cont->handle);
+}
+
+#endif // ESP_PLATFORM && !CONFIG_IDF_TARGET_LINUX
@@ -0,0 +1,104 @@
+/**
+ *
+ * Resumen:
+ * Fuente de muestras sintética: senoidal de punto fijo más ruido opcional.
+ * Reemplaza al ADC para medir el throughput de la cadena sin periféricos.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <math.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "adc_source.h"
+
+// Tabla de seno de 256 puntos en Q15, se calcula una sola vez
+#define SINE_TAB_BITS   (8)
+#define SINE_TAB_LEN    (1 << SINE_TAB_BITS)
+
+static int16_t sine_tab[SINE_TAB_LEN];
+static bool sine_tab_ready = false;
+
+static void sine_tab_init(void)
+{
+  for (int i = 0; i < SINE_TAB_LEN; i++) {
+    sine_tab[i] = (int16_t)(32767.0f * sinf(2.0f * (float)M_PI * i / SINE_TAB_LEN));
+  }
+  sine_tab_ready = true;
+}
+
+// Generador de ruido xorshift32
+static inline uint32_t synth_rand(adc_synth_t *s)
+{
+  uint32_t x = s->noise;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  s->noise = x;
+  return x;
+}
+
+static size_t synth_read_block(void *ctx, int16_t *dst, size_t len, TickType_t timeout, uint32_t *wait_us)
+{
+  adc_synth_t *s = (adc_synth_t *)ctx;
+
+  for (size_t i = 0; i < len; i++) {
+    int32_t v = ((int32_t)sine_tab[s->phase >> (32 - SINE_TAB_BITS)] * s->amplitude) >> 15;
+    if (s->noise_amp) {
+      v += (int32_t)(synth_rand(s) % (2u * s->noise_amp + 1)) - s->noise_amp;
+    }
+    v += s->offset;
+
+    // Saturar al rango de 12 bits del ADC
+    if (v < 0) {
+      v = 0;
+    } else if (v > 4095) {
+      v = 4095;
+    }
+    dst[i] = (int16_t)v;
+    s->phase += s->phase_inc;
+  }
+
+  // Respetar la frecuencia de muestreo simulada (resolución de un tick)
+  if (s->sample_rate) {
+    s->pending_us += (uint32_t)(((uint64_t)len * 1000000u) / s->sample_rate);
+    TickType_t ticks = s->pending_us / (portTICK_PERIOD_MS * 1000u);
+    if (ticks > 0) {
+      s->pending_us -= ticks * portTICK_PERIOD_MS * 1000u;
+      uint64_t t0 = adc_now_us();
+      vTaskDelay(ticks);
+      if (wait_us != NULL) {
+        *wait_us += (uint32_t)(adc_now_us() - t0);
+      }
+    }
+  }
+
+  return len;
+}
+
+void adc_source_synth_init(adc_source_t *src, adc_synth_t *synth,
+                           uint32_t sample_rate, uint32_t freq_hz,
+                           int16_t offset, int16_t amplitude, int16_t noise_amp)
+{
+  if (!sine_tab_ready) {
+    sine_tab_init();
+  }
+
+  // Sin frecuencia de muestreo se asume 1 kHz solo para calcular el paso de fase
+  uint32_t fs = sample_rate ? sample_rate : 1000;
+
+  synth->phase = 0;
+  synth->phase_inc = (uint32_t)(((uint64_t)freq_hz << 32) / fs);
+  synth->offset = offset;
+  synth->amplitude = amplitude;
+  synth->noise = 0x12345678;
+  synth->noise_amp = noise_amp;
+  synth->sample_rate = sample_rate;
+  synth->pending_us = 0;
+
+  src->name = "sintetica";
+  src->read_block = synth_read_block;
+  src->ctx = synth;
+}
@@ -0,0 +1,288 @@
+/**
+ *
+ * Resumen:
+ * Núcleos de procesamiento en punto fijo por bloques (ver dsp.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <math.h>
+#include <string.h>
+#include "dsp.h"
+
+// Saturar un valor de 32 bits al rango de int16_t
+static inline int16_t sat16(int32_t v)
+{
+  if (v > INT16_MAX) {
+    return INT16_MAX;
+  }
+  if (v < INT16_MIN) {
+    return INT16_MIN;
+  }
+  return (int16_t)v;
+}
+
+// Raíz cuadrada entera (bit a bit)
+static uint32_t isqrt64(uint64_t v)
+{
+  uint64_t res = 0;
+  uint64_t bit = (uint64_t)1 << 62;
+
+  while (bit > v) {
+    bit >>= 2;
+  }
+  while (bit != 0) {
+    if (v >= res + bit) {
+      v -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint32_t)res;
+}
+
+//*****************************************************************************
+// Promedio móvil
+
+void dsp_mavg_init(dsp_mavg_t *st, uint8_t log2_len)
+{
+  if (log2_len > DSP_MAVG_MAX_LOG2) {
+    log2_len = DSP_MAVG_MAX_LOG2;
+  }
+  st->log2_len = log2_len;
+  st->sum = 0;
+  memset(st->hist, 0, sizeof(st->hist));
+}
+
+void dsp_mavg(dsp_mavg_t *st, const int16_t *in, int16_t *out, size_t n)
+{
+  const size_t w = (size_t)1 << st->log2_len;
+  const size_t head = n < w ? n : w;
+  int32_t sum = st->sum;
+
+  // Se actualiza la suma con la muestra que entra menos la que sale de la
+  // ventana; dos tramos contiguos en lugar de un índice circular
+  for (size_t i = 0; i < head; i++) {
+    sum += (int32_t)in[i] - st->hist[i];
+    out[i] = (int16_t)(sum >> st->log2_len);
+  }
+  for (size_t i = head; i < n; i++) {
+    sum += (int32_t)in[i] - in[i - w];
+    out[i] = (int16_t)(sum >> st->log2_len);
+  }
+  st->sum = sum;
+
+  // Guardar las últimas w muestras para el próximo bloque
+  if (n >= w) {
+    memcpy(st->hist, in + n - w, w * sizeof(int16_t));
+  } else {
+    memmove(st->hist, st->hist + n, (w - n) * sizeof(int16_t));
+    memcpy(st->hist + w - n, in, n * sizeof(int16_t));
+  }
+}
+
+void dsp_mavg_ref(dsp_mavg_t *st, const int16_t *in, int16_t *out, size_t n)
+{
+  const size_t w = (size_t)1 << st->log2_len;
+
+  for (size_t i = 0; i < n; i++) {
+    // Desplazar la ventana y volver a sumarla completa
+    memmove(st->hist, st->hist + 1, (w - 1) * sizeof(int16_t));
+    st->hist[w - 1] = in[i];
+
+    int32_t sum = 0;
+    for (size_t j = 0; j < w; j++) {
+      sum += st->hist[j];
+    }
+    st->sum = sum;
+    out[i] = (int16_t)(sum >> st->log2_len);
+  }
+}
+
+//*****************************************************************************
+// FIR con decimación
+
+void dsp_fir_design_lowpass(int16_t *coef, size_t taps, float cutoff)
+{
+  float h[DSP_FIR_MAX_TAPS];
+  float sum = 0.0f;
+
+  // Recortar antes de calcular el centro
+  if (taps > DSP_FIR_MAX_TAPS) {
+    taps = DSP_FIR_MAX_TAPS;
+  }
+  if (taps == 0) {
+    return;
+  }
+  float mid = (taps - 1) / 2.0f;
+
+  // Sinc con ventana de Hamming; con un solo coeficiente la ventana es 1
+  for (size_t i = 0; i < taps; i++) {
+    float x = i - mid;
+    float sinc = (x == 0.0f) ? 2.0f * cutoff : sinf(2.0f * (float)M_PI * cutoff * x) / ((float)M_PI * x);
+    float win = (taps == 1) ? 1.0f : 0.54f - 0.46f * cosf(2.0f * (float)M_PI * i / (taps - 1));
+    h[i] = sinc * win;
+    sum += h[i];
+  }
+
+  // Normalizar a ganancia unitaria en continua y convertir a Q15
+  for (size_t i = 0; i < taps; i++) {
+    coef[i] = sat16((int32_t)lroundf(h[i] / sum * 32768.0f));
+  }
+}
+
+void dsp_fir_init(dsp_fir_t *st, const int16_t *coef, size_t taps, size_t decim)
+{
+  if (taps > DSP_FIR_MAX_TAPS) {
+    taps = DSP_FIR_MAX_TAPS;
+  }
+  st->coef = coef;
+  st->taps = taps;
+  st->decim = decim ? decim : 1;
+  st->phase = 0;
+  memset(st->work, 0, sizeof(st->work));
+
+  // Coeficientes invertidos para recorrer ambos vectores hacia adelante
+  for (size_t j = 0; j < taps; j++) {
+    st->rcoef[j] = coef[taps - 1 - j];
+  }
+}
+
+// Producto punto de un tramo contiguo (el bucle que vectoriza el compilador)
+static inline int32_t dot_q15(const int16_t *restrict a, const int16_t *restrict b, size_t n)
+{
+  int32_t acc = 0;
+  for (size_t j = 0; j < n; j++) {
+    acc += (int32_t)a[j] * b[j];
+  }
+  return acc;
+}
+
+// Un tramo de hasta DSP_MAX_BLOCK muestras (lo que entra en work)
+static size_t fir_decim_chunk(dsp_fir_t *st, const int16_t *in, int16_t *out, size_t n)
+{
+  const size_t h = st->taps - 1;
+  size_t k = 0;
+  size_t i;
+
+  // La historia ya está al comienzo de work, se agrega el bloque a continuación
+  memcpy(st->work + h, in, n * sizeof(int16_t));
+
+  // Solo se calculan las salidas que sobreviven a la decimación
+  for (i = st->phase; i < n; i += st->decim) {
+    int32_t acc = dot_q15(st->rcoef, &st->work[i], st->taps);
+    out[k++] = sat16((acc + (1 << 14)) >> 15);
+  }
+
+  st->phase = i - n;
+  memmove(st->work, st->work + n, h * sizeof(int16_t));
+
+  return k;
+}
+
+size_t dsp_fir_decim(dsp_fir_t *st, const int16_t *in, int16_t *out, size_t n)
+{
+  size_t k = 0;
+
+  // Un bloque mayor que DSP_MAX_BLOCK se procesa por tramos; la historia y la
+  // fase pasan de un tramo al siguiente igual que entre bloques
+  while (n > 0) {
+    size_t len = (n > DSP_MAX_BLOCK) ? DSP_MAX_BLOCK : n;
+
+    k += fir_decim_chunk(st, in, out + k, len);
+    in += len;
+    n -= len;
+  }
+
+  return k;
+}
+
+size_t dsp_fir_decim_ref(dsp_fir_t *st, const int16_t *in, int16_t *out, size_t n)
+{
+  const size_t h = st->taps - 1;
+  size_t next = st->phase;
+  size_t k = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    if (i == next) {
+      // coef[0] multiplica a la muestra más nueva
+      int32_t acc = (int32_t)st->coef[0] * in[i];
+      for (size_t j = 1; j < st->taps; j++) {
+        acc += (int32_t)st->coef[j] * st->work[h - j];
+      }
+      out[k++] = sat16((acc + (1 << 14)) >> 15);
+      next += st->decim;
+    }
+
+    // Desplazar la línea de retardo
+    if (h > 0) {
+      memmove(st->work, st->work + 1, (h - 1) * sizeof(int16_t));
+      st->work[h - 1] = in[i];
+    }
+  }
+
+  st->phase = next - n;
+  return k;
+}
+
+//*****************************************************************************
+// Estadísticas
+
+void dsp_stats(const int16_t *in, size_t n, dsp_stats_t *out)
+{
+  int16_t mn = INT16_MAX;
+  int16_t mx = INT16_MIN;
+  int32_t sum = 0;
+  int64_t sumsq = 0;
+
+  if (n == 0) {
+    memset(out, 0, sizeof(*out));
+    return;
+  }
+
+  // Una sola pasada sin ramas (mín/máx como selección, reducciones independientes)
+  for (size_t i = 0; i < n; i++) {
+    int16_t x = in[i];
+    mn = x < mn ? x : mn;
+    mx = x > mx ? x : mx;
+    sum += x;
+    sumsq += (int32_t)x * x;
+  }
+
+  out->min = mn;
+  out->max = mx;
+  out->mean = (int16_t)(sum / (int32_t)n);
+  out->rms = (uint16_t)isqrt64((uint64_t)sumsq / n);
+}
+
+void dsp_stats_ref(const int16_t *in, size_t n, dsp_stats_t *out)
+{
+  int16_t mn = INT16_MAX;
+  int16_t mx = INT16_MIN;
+  int32_t sum = 0;
+  int64_t sumsq = 0;
+
+  if (n == 0) {
+    memset(out, 0, sizeof(*out));
+    return;
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    if (in[i] < mn) {
+      mn = in[i];
+    }
+    if (in[i] > mx) {
+      mx = in[i];
+    }
+    sum += in[i];
+    sumsq += (int32_t)in[i] * in[i];
+  }
+
+  out->min = mn;
+  out->max = mx;
+  out->mean = (int16_t)(sum / (int32_t)n);
+  out->rms = (uint16_t)isqrt64((uint64_t)sumsq / n);
+}
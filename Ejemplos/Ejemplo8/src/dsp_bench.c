@@ -0,0 +1,134 @@
+/**
+ *
+ * Resumen:
+ * Medición de los núcleos de dsp.h: verifica cada versión por bloques contra
+ * su referencia escalar y reporta muestras por segundo de ambas, para saber
+ * cuánto filtrado entra en el presupuesto antes de que la salida sea el cuello
+ * de botella.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "adc_source.h"
+#include "dsp.h"
+
+#include "bench_clock.h"
+
+// Configuración
+#define BENCH_BLOCK       (256)   // Muestras por bloque
+#define BENCH_BLOCKS      (16)    // Bloques distintos de entrada
+#define BENCH_ITERS       (200)   // Bloques procesados por medición
+#define BENCH_MAVG_LOG2   (4)     // Ventana de 16 muestras
+#define BENCH_FIR_TAPS    (32)
+#define BENCH_FIR_DECIM   (4)
+
+// Estado grande fuera de la pila de la tarea
+static int16_t input[BENCH_BLOCKS][BENCH_BLOCK];
+static int16_t out_a[BENCH_BLOCK];
+static int16_t out_b[BENCH_BLOCK];
+static int16_t coef[BENCH_FIR_TAPS];
+static dsp_mavg_t mavg_a, mavg_b;
+static dsp_fir_t fir_a, fir_b;
+
+// Imprimir una línea de resultados
+static void bench_report(const char *name, uint64_t us_opt, uint64_t us_ref, bool ok)
+{
+  const double samples = (double)BENCH_ITERS * BENCH_BLOCK;
+
+  printf("%-12s | bloque: %9.0f muestras/s | escalar: %9.0f muestras/s | x%.1f | %s\n",
+         name,
+         us_opt ? samples * 1e6 / us_opt : 0.0,
+         us_ref ? samples * 1e6 / us_ref : 0.0,
+         us_opt ? (double)us_ref / us_opt : 0.0,
+         ok ? "OK" : "DIFIERE");
+}
+
+void dsp_benchmark(void)
+{
+  adc_source_t src;
+  adc_synth_t synth;
+  uint64_t t0, us_opt, us_ref;
+  bool ok;
+
+  // Entrada: senoidal sintética con ruido, generada sin pausas
+  adc_source_synth_init(&src, &synth, 0, 37, 2048, 1500, 50);
+  for (int b = 0; b < BENCH_BLOCKS; b++) {
+    src.read_block(src.ctx, input[b], BENCH_BLOCK, 0, NULL);
+  }
+  dsp_fir_design_lowpass(coef, BENCH_FIR_TAPS, 0.5f / BENCH_FIR_DECIM);
+
+  printf("---Medición DSP (bloques de %d muestras)---\n", BENCH_BLOCK);
+
+  //-------------Promedio móvil---------------//
+  dsp_mavg_init(&mavg_a, BENCH_MAVG_LOG2);
+  dsp_mavg_init(&mavg_b, BENCH_MAVG_LOG2);
+  ok = true;
+  for (int b = 0; b < BENCH_BLOCKS; b++) {
+    dsp_mavg(&mavg_a, input[b], out_a, BENCH_BLOCK);
+    dsp_mavg_ref(&mavg_b, input[b], out_b, BENCH_BLOCK);
+    ok = ok && memcmp(out_a, out_b, sizeof(out_a)) == 0;
+  }
+
+  t0 = bench_now_us();
+  for (int it = 0; it < BENCH_ITERS; it++) {
+    dsp_mavg(&mavg_a, input[it % BENCH_BLOCKS], out_a, BENCH_BLOCK);
+  }
+  us_opt = bench_now_us() - t0;
+
+  t0 = bench_now_us();
+  for (int it = 0; it < BENCH_ITERS; it++) {
+    dsp_mavg_ref(&mavg_b, input[it % BENCH_BLOCKS], out_b, BENCH_BLOCK);
+  }
+  us_ref = bench_now_us() - t0;
+  bench_report("prom. movil", us_opt, us_ref, ok);
+
+  //-------------FIR con decimación---------------//
+  dsp_fir_init(&fir_a, coef, BENCH_FIR_TAPS, BENCH_FIR_DECIM);
+  dsp_fir_init(&fir_b, coef, BENCH_FIR_TAPS, BENCH_FIR_DECIM);
+  ok = true;
+  for (int b = 0; b < BENCH_BLOCKS; b++) {
+    size_t na = dsp_fir_decim(&fir_a, input[b], out_a, BENCH_BLOCK);
+    size_t nb = dsp_fir_decim_ref(&fir_b, input[b], out_b, BENCH_BLOCK);
+    ok = ok && na == nb && memcmp(out_a, out_b, na * sizeof(int16_t)) == 0;
+  }
+
+  t0 = bench_now_us();
+  for (int it = 0; it < BENCH_ITERS; it++) {
+    dsp_fir_decim(&fir_a, input[it % BENCH_BLOCKS], out_a, BENCH_BLOCK);
+  }
+  us_opt = bench_now_us() - t0;
+
+  t0 = bench_now_us();
+  for (int it = 0; it < BENCH_ITERS; it++) {
+    dsp_fir_decim_ref(&fir_b, input[it % BENCH_BLOCKS], out_b, BENCH_BLOCK);
+  }
+  us_ref = bench_now_us() - t0;
+  bench_report("fir decim", us_opt, us_ref, ok);
+
+  //-------------Estadísticas---------------//
+  dsp_stats_t sa, sb;
+  ok = true;
+  for (int b = 0; b < BENCH_BLOCKS; b++) {
+    dsp_stats(input[b], BENCH_BLOCK, &sa);
+    dsp_stats_ref(input[b], BENCH_BLOCK, &sb);
+    ok = ok && memcmp(&sa, &sb, sizeof(sa)) == 0;
+  }
+
+  t0 = bench_now_us();
+  for (int it = 0; it < BENCH_ITERS; it++) {
+    dsp_stats(input[it % BENCH_BLOCKS], BENCH_BLOCK, &sa);
+  }
+  us_opt = bench_now_us() - t0;
+
+  t0 = bench_now_us();
+  for (int it = 0; it < BENCH_ITERS; it++) {
+    dsp_stats_ref(input[it % BENCH_BLOCKS], BENCH_BLOCK, &sb);
+  }
+  us_ref = bench_now_us() - t0;
+  bench_report("estadisticas", us_opt, us_ref, ok);
+}
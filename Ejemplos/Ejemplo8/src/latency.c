@@ -0,0 +1,75 @@
+/**
+ *
+ * Resumen:
+ * Histogramas de latencia log2 (ver latency.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "esp_attr.h"
+#include "latency.h"
+
+// En IRAM para poder llamarse desde una ISR con la caché deshabilitada
+void IRAM_ATTR lat_record_value(lat_path_t *path, uint32_t ticks)
+{
+  // Casillero = cantidad de bits significativos (0 para latencia 0)
+  uint32_t bucket = ticks ? 32 - __builtin_clz(ticks) : 0;
+  if (bucket >= LAT_HIST_BUCKETS) {
+    bucket = LAT_HIST_BUCKETS - 1;
+  }
+
+  path->count++;
+  path->sum += ticks;
+  if (ticks > path->max) {
+    path->max = ticks;
+  }
+  path->hist[bucket]++;
+}
+
+void IRAM_ATTR lat_record(lat_path_t *path, uint32_t start, uint32_t end)
+{
+  // La resta sin signo es correcta aunque el contador haya dado la vuelta
+  lat_record_value(path, end - start);
+}
+
+void lat_reset(lat_path_t *path)
+{
+  const char *name = path->name;
+
+  memset(path, 0, sizeof(*path));
+  path->name = name;
+}
+
+void lat_dump(lat_path_t *paths, size_t n)
+{
+  printf("---Latencias (us)---\n");
+
+  for (size_t i = 0; i < n; i++) {
+    // Copia local sin bloqueo: lat_record no usa spinlock, así que si la ISR
+    // registra durante la copia los campos pueden diferir en esas pocas
+    // muestras (la suma de hist no coincide exactamente con count). Alcanza
+    // para un informe; la copia solo evita que cambien mientras se imprime.
+    lat_path_t p = paths[i];
+
+    printf("%-14s | n: %7lu | media: %8.2f | max: %8.2f\n",
+           p.name, (unsigned long)p.count,
+           p.count ? (double)p.sum / p.count / LAT_TICKS_PER_US : 0.0,
+           (double)p.max / LAT_TICKS_PER_US);
+
+    // Solo los casilleros con cuentas, como límite superior en us
+    for (int b = 0; b < LAT_HIST_BUCKETS; b++) {
+      if (p.hist[b] == 0) {
+        continue;
+      }
+      if (b == 0) {
+        printf("    = %10.2f : %lu\n", 0.0, (unsigned long)p.hist[b]);
+      } else {
+        printf("    < %10.2f : %lu\n", (double)((uint64_t)1 << b) / LAT_TICKS_PER_US,
+               (unsigned long)p.hist[b]);
+      }
+    }
+  }
+}
@@ -2,6 +2,16 @@
  * 
  * Resumen:
  * Leer valores de ADC en ISR a 1 Hz y diferir la impresión de ellos en una tarea.
+ * Las muestras pasan por un buffer circular lock-free (sample_ring) para que
+ * ninguna lectura se pierda si la tarea de impresión se atrasa.
+ * Con STREAM_EN el ADC trabaja en modo continuo (o con una fuente sintética)
+ * y las muestras se entregan en bloques con doble buffer (adc_stream), que se
+ * filtran (promedio móvil + FIR con decimación) antes de reportar estadísticas.
+ * Con TELEMETRY_EN los valores salen en tramas binarias (telemetry) en lugar de
+ * un printf por muestra, con la marca de tiempo real de la ISR;
+ * components/telemetry/tools/telemetry_decode.c las convierte a CSV.
+ * Con LATENCY_EN se mide el camino ISR -> semáforo -> tarea con histogramas
+ * (latency) y con LOAD_EN se agregan tareas de carga para ver el jitter.
  * Documentacion: https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/adc_oneshot.html
 				https://docs.espressif.com/projects/esp-idf/en/v4.3/esp32/api-reference/peripherals/timer.html
  * 
@@ -20,6 +30,45 @@
 #include "freertos/FreeRTOS.h"
 #include "esp_timer.h"
 #include "esp_adc/adc_oneshot.h"
+#include "sample_ring.h"
+#include "adc_stream.h"
+#include "dsp.h"
+#include "telemetry.h"
+#include "telemetry_bench.h"
+#include "latency.h"
+#include "ws_exec.h"
+#include "stack_prof.h"
+
+// Descomentar para muestrear a alta frecuencia e imprimir solo un resumen por segundo
+//#define STRESS_EN
+
+// Descomentar para adquirir por bloques en lugar de una lectura por interrupción
+//#define STREAM_EN
+// Descomentar (junto con STREAM_EN) para usar la señal sintética en lugar del ADC
+//#define STREAM_SYNTH
+
+// Descomentar para medir los filtros DSP al iniciar
+//#define DSP_BENCH_EN
+// Descomentar para medir el filtrado de varios canales repartido entre los dos núcleos
+//#define WS_BENCH_EN
+
+// Descomentar para enviar los valores en tramas binarias en lugar de texto
+//#define TELEMETRY_EN
+// Descomentar para medir la telemetría binaria contra printf al iniciar
+//#define TELEM_BENCH_EN
+
+// Descomentar para medir la latencia ISR -> tarea e imprimir histogramas
+//#define LATENCY_EN
+// Descomentar para agregar tareas que acaparan la CPU (como en el Ejemplo10)
+//#define LOAD_EN
+
+// Descomentar para informar periódicamente el peor caso de pila de todas las tareas
+//#define STACK_PROF_EN
+
+// Con telemetría de una lectura por ISR cada muestra guarda su instante real
+#if defined(TELEMETRY_EN) && !defined(STRESS_EN)
+  #define SAMPLE_STAMPS
+#endif
 
 // Usar solo el núcleo 1 para propósitos de demostración
 #if CONFIG_FREERTOS_UNICORE
@@ -28,18 +77,85 @@
   static const BaseType_t app_cpu = 1;
 #endif
 
+// El contador de ciclos es propio de cada núcleo: para medir latencias la tarea
+// corre en el núcleo de la tarea de esp_timer (CONFIG_ESP_TIMER_TASK_AFFINITY_CPU0)
+#ifdef LATENCY_EN
+  static const BaseType_t print_cpu = 0;
+#else
+  static const BaseType_t print_cpu = app_cpu;
+#endif
+
 // Configuración
 #define TIMER_DIVIDER         (80)  // Divisor de reloj del temporizador de hardware
 #define TIMER_SCALE           (80000000 / TIMER_DIVIDER)  // convertir valor del contador a segundos
+#define RING_LEN              (256) // Capacidad del buffer de muestras (potencia de 2)
+#define BATCH_LEN             (32)  // Muestras leídas por la tarea en cada lote
+
+#ifdef STRESS_EN
+  #define TIMER_PERIOD_US     (100)     // 10 kHz
+#else
+  #define TIMER_PERIOD_US     (1000000) // 1 Hz
+#endif
+
+#define STREAM_BLOCK_LEN      (256)     // Muestras por bloque en modo streaming
+#define STREAM_SAMPLE_RATE    (20000)   // Hz (mínimo del modo continuo en ESP32)
+#define DSP_MAVG_LOG2         (3)       // Promedio móvil de 8 muestras
+#define DSP_FIR_TAPS          (32)
+#define DSP_DECIM             (10)      // 20 kHz -> 2 kHz
+#define LAT_DUMP_MS           (5000)    // Período de impresión de latencias
+#define LOAD_BUSY_MS          (5)       // Tiempo que la tarea de carga acapara la CPU
+#define LOAD_SLEEP_MS         (50)      // Tiempo que la tarea de carga duerme
 
 // Pines
 #define ADC_EXAMPLE_CHAN      ADC_CHANNEL_0
 
 // Variables globales
 adc_oneshot_unit_handle_t adc1_handle;
-int val;
+static int16_t ring_storage[RING_LEN];
+#ifdef SAMPLE_STAMPS
+static int64_t ring_stamps[RING_LEN];   // esp_timer_get_time() de cada muestra
+#endif
+static sample_ring_t ring;
 SemaphoreHandle_t bin_sem = NULL;
 
+#ifdef STREAM_EN
+static adc_source_t source;
+static adc_stream_t stream;
+#ifdef STREAM_SYNTH
+static adc_synth_t synth;
+#else
+static adc_cont_t cont;
+#endif
+static dsp_mavg_t mavg;
+static dsp_fir_t fir;
+static int16_t fir_coef[DSP_FIR_TAPS];
+static int16_t filtered[STREAM_BLOCK_LEN];
+static int16_t decimated[STREAM_BLOCK_LEN / DSP_DECIM + 1];
+#endif
+
+#ifdef TELEMETRY_EN
+static uint8_t telem_frame[TELEM_MAX_FRAME];
+#endif
+
+#ifdef LATENCY_EN
+// Marcas de tiempo de la última interrupción (las lee la tarea al despertar)
+static volatile uint32_t ts_isr = 0;
+static volatile uint32_t ts_give = 0;
+static uint32_t ts_prev_isr = 0;
+
+enum { LAT_ISR_GIVE, LAT_GIVE_TASK, LAT_ISR_TASK, LAT_ISR_JITTER, LAT_NUM_PATHS };
+static lat_path_t lat_paths[LAT_NUM_PATHS] = {
+  [LAT_ISR_GIVE]   = LAT_PATH_INIT("isr->give"),
+  [LAT_GIVE_TASK]  = LAT_PATH_INIT("give->tarea"),
+  [LAT_ISR_TASK]   = LAT_PATH_INIT("isr->tarea"),
+  [LAT_ISR_JITTER] = LAT_PATH_INIT("jitter isr"),
+};
+#endif
+
+#ifdef STRESS_EN
+static uint64_t isr_us = 0;     // Tiempo total dentro de la ISR (costo del modo de una lectura)
+#endif
+
 //*****************************************************************************
 // Rutinas de Servicio de Interrupciones (ISRs)
 
@@ -48,13 +164,49 @@ SemaphoreHandle_t bin_sem = NULL;
  */
 static void IRAM_ATTR onTimer() {
   BaseType_t task_woken = pdFALSE;
+  int val;
+#ifdef STRESS_EN
+  int64_t t0 = esp_timer_get_time();
+#endif
+#ifdef LATENCY_EN
+  uint32_t t_entry = lat_now();
+
+  // Desvío del intervalo entre interrupciones respecto del período nominal
+  if (ts_prev_isr != 0) {
+    const uint32_t nominal = TIMER_PERIOD_US * LAT_TICKS_PER_US;
+    uint32_t delta = t_entry - ts_prev_isr;
+    lat_record_value(&lat_paths[LAT_ISR_JITTER], delta > nominal ? delta - nominal : nominal - delta);
+  }
+  ts_prev_isr = t_entry;
+#endif
+#ifdef SAMPLE_STAMPS
+  int64_t t_sample = esp_timer_get_time();
+#endif
 
   // Realizar acción (leer del ADC)
   ESP_ERROR_CHECK(adc_oneshot_read(adc1_handle, ADC_EXAMPLE_CHAN, &val));
 
-  // Dar semáforo para indicar a la tarea que un nuevo valor está listo
+  // Guardar la muestra en el buffer (si está lleno se cuenta como overrun)
+#ifdef SAMPLE_STAMPS
+  sample_ring_push_stamped(&ring, (int16_t)val, t_sample);
+#else
+  sample_ring_push(&ring, (int16_t)val);
+#endif
+
+#ifdef LATENCY_EN
+  // Publicar las marcas antes del give para que la tarea nunca lea unas viejas
+  ts_isr = t_entry;
+  ts_give = lat_now();
+  lat_record(&lat_paths[LAT_ISR_GIVE], t_entry, ts_give);
+#endif
+
+  // Dar semáforo para indicar a la tarea que hay valores nuevos
   xSemaphoreGiveFromISR(bin_sem, &task_woken);
 
+#ifdef STRESS_EN
+  isr_us += esp_timer_get_time() - t0;
+#endif
+
   // Salir de la ISR (FreeRTOS estándar)
   //portYIELD_FROM_ISR(task_woken);
 
@@ -67,18 +219,178 @@ static void IRAM_ATTR onTimer() {
 //*****************************************************************************
 // Tareas
 
+#ifdef SAMPLE_STAMPS
+/**
+ * @brief Enviar un lote en tramas con la marca real de su primera muestra
+ *
+ * Una trama supone muestras equiespaciadas: si entre dos muestras no pasó
+ * un período (muestra perdida o ISR atrasada) se abre una trama nueva.
+ */
+static void sendStamped(telem_enc_t *enc, const int16_t *batch, const int64_t *stamps, size_t n) {
+  size_t first = 0;
+
+  for (size_t i = 1; i <= n; i++) {
+    int64_t gap = (i < n) ? stamps[i] - stamps[i - 1] : 0;
+
+    if (i == n || gap < TIMER_PERIOD_US / 2 || gap > TIMER_PERIOD_US * 3 / 2) {
+      size_t len = telem_encode(enc, (uint64_t)stamps[first], TIMER_PERIOD_US,
+                                &batch[first], i - first, telem_frame);
+      fwrite(telem_frame, 1, len, stdout);
+      first = i;
+    }
+  }
+  fflush(stdout);
+}
+#endif
+
 // 
 /**
- * @brief Esperar por semáforo e imprimir el valor de ADC cuando se reciba
+ * @brief Esperar por semáforo e imprimir los valores de ADC acumulados
+ *
+ * El semáforo binario puede recibir varios "give" antes de que la tarea
+ * se ejecute, por eso se vacía el buffer completo en lotes cada vez.
  */
 void printValues(void *parameters) {
+  int16_t batch[BATCH_LEN];
+  size_t n;
+#ifdef STRESS_EN
+  uint32_t consumed = 0;
+  int64_t last_report = esp_timer_get_time();
+#endif
+#ifdef SAMPLE_STAMPS
+  static telem_enc_t enc;
+  static int64_t stamps[BATCH_LEN];     // Instante de cada muestra del lote
+  telem_enc_init(&enc, 0, TELEM_FMT_U12);
+#else
+  int64_t *stamps = NULL;
+#endif
 
-  // Bucle infinito, esperar por semáforo e imprimir valor
+  // Bucle infinito, esperar por semáforo e imprimir valores
   while (1) {
     xSemaphoreTake(bin_sem, portMAX_DELAY);
-    printf("%d\n", val); 
+
+#ifdef LATENCY_EN
+    // Si se acumularon varios "give" se mide contra la última interrupción
+    uint32_t t_wake = lat_now();
+    lat_record(&lat_paths[LAT_GIVE_TASK], ts_give, t_wake);
+    lat_record(&lat_paths[LAT_ISR_TASK], ts_isr, t_wake);
+#endif
+
+    while ((n = sample_ring_pop_n_stamped(&ring, batch, stamps, BATCH_LEN)) > 0) {
+#ifdef STRESS_EN
+      consumed += n;
+#elif defined(SAMPLE_STAMPS)
+      // Tramas con la marca de tiempo real de la primera muestra
+      sendStamped(&enc, batch, stamps, n);
+#else
+      for (size_t i = 0; i < n; i++) {
+        printf("%d\n", batch[i]);
+      }
+#endif
+    }
+
+#ifdef STRESS_EN
+    // Resumen una vez por segundo: producidas, consumidas, perdidas y ocupación máxima
+    if (esp_timer_get_time() - last_report >= 1000000) {
+      last_report = esp_timer_get_time();
+      printf("producidas: %lu | consumidas: %lu | perdidas: %lu | max ocupación: %lu/%d | us/muestra: %.2f\n",
+             (unsigned long)ring.pushed, (unsigned long)consumed,
+             (unsigned long)ring.overruns, (unsigned long)ring.high_water, RING_LEN,
+             ring.pushed ? (double)isr_us / ring.pushed : 0.0);
+    }
+#endif
+  }
+}
+
+#ifdef LATENCY_EN
+/**
+ * @brief Imprimir periódicamente los histogramas de latencia
+ */
+void dumpLatency(void *parameters) {
+  while (1) {
+    vTaskDelay(LAT_DUMP_MS / portTICK_PERIOD_MS);
+    lat_dump(lat_paths, LAT_NUM_PATHS);
+  }
+}
+#endif
+
+#ifdef LOAD_EN
+/**
+ * @brief Acaparar la CPU un tiempo sin hacer nada y dormir (carga de fondo)
+ */
+void doLoad(void *parameters) {
+  TickType_t timestamp;
+
+  while (1) {
+    timestamp = xTaskGetTickCount() * portTICK_PERIOD_MS;
+    while ((xTaskGetTickCount() * portTICK_PERIOD_MS) - timestamp < LOAD_BUSY_MS);
+    vTaskDelay(LOAD_SLEEP_MS / portTICK_PERIOD_MS);
+  }
+}
+#endif
+
+#ifdef STREAM_EN
+/**
+ * @brief Filtrar bloques completos e imprimir un resumen por segundo
+ *
+ * Se reporta la tasa lograda, los bloques perdidos, el costo de CPU por
+ * muestra en la adquisición (para comparar con el modo de una lectura por ISR)
+ * y las estadísticas de la señal filtrada y decimada.
+ */
+void processBlocks(void *parameters) {
+  uint32_t samples = 0;
+  uint64_t dsp_us = 0;
+  dsp_stats_t stats;
+  int64_t last_report = esp_timer_get_time();
+#ifdef TELEMETRY_EN
+  static telem_enc_t enc;
+  const uint32_t period_us = 1000000 / (STREAM_SAMPLE_RATE / DSP_DECIM);
+  uint64_t index = 0;     // El reloj del ADC fija el período: marca por muestras
+  telem_enc_init(&enc, 1, TELEM_FMT_I16);
+#endif
+
+  while (1) {
+    const int16_t *block = adc_stream_get_block(&stream, portMAX_DELAY);
+
+    // Promedio móvil -> FIR pasa bajos con decimación -> estadísticas
+    int64_t t0 = esp_timer_get_time();
+    dsp_mavg(&mavg, block, filtered, STREAM_BLOCK_LEN);
+    size_t n = dsp_fir_decim(&fir, filtered, decimated, STREAM_BLOCK_LEN);
+    dsp_stats(decimated, n, &stats);
+    dsp_us += esp_timer_get_time() - t0;
+
+    samples += STREAM_BLOCK_LEN;
+    adc_stream_release_block(&stream, block);
+
+#ifdef TELEMETRY_EN
+    // Enviar la señal decimada; el resumen por segundo sigue saliendo entre
+    // las tramas y telemetry_decode lo descarta porque no pasa el CRC
+    size_t len = telem_encode(&enc, index * period_us, period_us, decimated, n, telem_frame);
+    fwrite(telem_frame, 1, len, stdout);
+    fflush(stdout);
+    index += n;
+#endif
+
+    int64_t now = esp_timer_get_time();
+    if (now - last_report >= 1000000) {
+      adc_stream_stats_t st;
+      adc_stream_get_stats(&stream, &st);
+      uint32_t total = (st.blocks_done + st.blocks_dropped) * STREAM_BLOCK_LEN;
+      printf("fuente: %s | muestras/s: %lu | bloques: %lu | descartados: %lu | us/muestra: %.3f | dsp us/muestra: %.3f\n",
+             source.name,
+             (unsigned long)((uint64_t)samples * 1000000 / (now - last_report)),
+             (unsigned long)st.blocks_done, (unsigned long)st.blocks_dropped,
+             total ? (double)st.work_us / total : 0.0,
+             samples ? (double)dsp_us / samples : 0.0);
+      printf("min: %d | max: %d | media: %d | rms: %u\n",
+             stats.min, stats.max, stats.mean, stats.rms);
+      samples = 0;
+      dsp_us = 0;
+      last_report = now;
+    }
   }
 }
+#endif
 
 //*****************************************************************************
 /**
@@ -95,7 +407,7 @@ static void example_tg_timer_init()
 
   ESP_ERROR_CHECK(esp_timer_create(&timer_config, &timer_handle));
   /* Iniciar los temporizadores */
-  ESP_ERROR_CHECK(esp_timer_start_periodic(timer_handle, 1000000));
+  ESP_ERROR_CHECK(esp_timer_start_periodic(timer_handle, TIMER_PERIOD_US));
 }
 
 //*****************************************************************************
@@ -124,12 +436,61 @@ static void example_adc_init(void)
 // Main (se ejecuta como su propia tarea con prioridad 1 en el núcleo 1)
 
 void app_main() {
+#ifdef STACK_PROF_EN
+    // Informe de pila de todas las tareas, también las del sistema (IDLE, Tmr Svc, esp_timer)
+    stack_prof_start(STACK_PROF_DEFAULT_PERIOD_MS, STACK_PROF_DEFAULT_MARGIN, 1, tskNO_AFFINITY);
+#endif
+
     // Configurar Serial
 
     // Esperar un momento para comenzar (para no perder la salida Serial)
     vTaskDelay(1000 / portTICK_PERIOD_MS);
     printf("\n---Demostración de Buffer ISR en FreeRTOS---\n");
 
+#ifdef DSP_BENCH_EN
+    dsp_benchmark();
+#endif
+#ifdef WS_BENCH_EN
+    ws_exec_benchmark();
+#endif
+#ifdef TELEM_BENCH_EN
+    telem_benchmark();
+#endif
+
+#ifdef STREAM_EN
+    // Preparar la etapa de filtrado (corte en la mitad de la nueva frecuencia de Nyquist)
+    dsp_mavg_init(&mavg, DSP_MAVG_LOG2);
+    dsp_fir_design_lowpass(fir_coef, DSP_FIR_TAPS, 0.5f / DSP_DECIM);
+    dsp_fir_init(&fir, fir_coef, DSP_FIR_TAPS, DSP_DECIM);
+
+    // Seleccionar la fuente de muestras
+  #ifdef STREAM_SYNTH
+    adc_source_synth_init(&source, &synth, STREAM_SAMPLE_RATE, 50, 2048, 1500, 20);
+  #else
+    ESP_ERROR_CHECK(adc_source_cont_init(&source, &cont, ADC_EXAMPLE_CHAN, STREAM_SAMPLE_RATE));
+  #endif
+
+    // Iniciar la adquisición (mayor prioridad que el consumidor)
+    if (adc_stream_start(&stream, &source, STREAM_BLOCK_LEN, 3, app_cpu) != pdPASS) {
+        printf("No se pudo iniciar la adquisición por bloques\n");
+        esp_restart();
+    }
+    xTaskCreatePinnedToCore(processBlocks,
+                            "Procesar bloques",
+                            2048,
+                            NULL,
+                            2,
+                            NULL,
+                            app_cpu);
+#else
+
+    // Inicializar el buffer de muestras antes de iniciar el temporizador
+#ifdef SAMPLE_STAMPS
+    sample_ring_init_stamped(&ring, ring_storage, ring_stamps, RING_LEN);
+#else
+    sample_ring_init(&ring, ring_storage, RING_LEN);
+#endif
+
     // Crear semáforo antes de que se use (en tarea o ISR)
     bin_sem = xSemaphoreCreateBinary();
 
@@ -146,12 +507,30 @@ void app_main() {
                             NULL,
                             2,
                             NULL,
-                            app_cpu);
+                            print_cpu);
+
+#ifdef LATENCY_EN
+    // Tarea de baja prioridad para imprimir los histogramas
+    xTaskCreatePinnedToCore(dumpLatency,
+                            "Latencias",
+                            3072,
+                            NULL,
+                            1,
+                            NULL,
+                            print_cpu);
+#endif
+
+#ifdef LOAD_EN
+    // Carga de menor y de mayor prioridad que la tarea de impresión
+    xTaskCreatePinnedToCore(doLoad, "Carga baja", 2048, NULL, 1, NULL, print_cpu);
+    xTaskCreatePinnedToCore(doLoad, "Carga alta", 2048, NULL, 3, NULL, print_cpu);
+#endif
 
     // Inicializar ADC
     example_adc_init();
     // Crear e iniciar temporizador (num, divisor, countUp)
     example_tg_timer_init();
+#endif
     
     
     while(1){
@@ -0,0 +1,115 @@
+/**
+ *
+ * Resumen:
+ * Implementación del buffer circular SPSC de muestras (ver sample_ring.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <string.h>
+#include "esp_attr.h"
+#include "sample_ring.h"
+
+bool sample_ring_init(sample_ring_t *ring, int16_t *storage, size_t capacity)
+{
+  return sample_ring_init_stamped(ring, storage, NULL, capacity);
+}
+
+bool sample_ring_init_stamped(sample_ring_t *ring, int16_t *storage, int64_t *stamps, size_t capacity)
+{
+  // La capacidad debe ser potencia de 2 (y distinta de 0)
+  if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+    return false;
+  }
+
+  ring->buf = storage;
+  ring->stamps = stamps;
+  ring->mask = capacity - 1;
+  atomic_init(&ring->head, 0);
+  atomic_init(&ring->tail, 0);
+  ring->pushed = 0;
+  ring->overruns = 0;
+  ring->high_water = 0;
+
+  return true;
+}
+
+// En IRAM para poder llamarse desde una ISR con la caché deshabilitada
+bool IRAM_ATTR sample_ring_push(sample_ring_t *ring, int16_t sample)
+{
+  return sample_ring_push_stamped(ring, sample, 0);
+}
+
+bool IRAM_ATTR sample_ring_push_stamped(sample_ring_t *ring, int16_t sample, int64_t t_us)
+{
+  uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+  uint32_t used = head - tail;
+
+  // Buffer lleno: descartar la muestra nueva y contabilizarla
+  if (used > ring->mask) {
+    ring->overruns++;
+    return false;
+  }
+
+  ring->buf[head & ring->mask] = sample;
+  if (ring->stamps != NULL) {
+    ring->stamps[head & ring->mask] = t_us;
+  }
+
+  // Publicar la muestra al consumidor (release ordena la escritura del dato)
+  atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+
+  ring->pushed++;
+  if (used + 1 > ring->high_water) {
+    ring->high_water = used + 1;
+  }
+
+  return true;
+}
+
+size_t sample_ring_pop_n(sample_ring_t *ring, int16_t *dst, size_t max)
+{
+  return sample_ring_pop_n_stamped(ring, dst, NULL, max);
+}
+
+size_t sample_ring_pop_n_stamped(sample_ring_t *ring, int16_t *dst, int64_t *dst_stamps, size_t max)
+{
+  uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+  uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+  size_t n = head - tail;
+
+  if (n > max) {
+    n = max;
+  }
+  if (n == 0) {
+    return 0;
+  }
+
+  // Copiar en a lo sumo dos tramos contiguos (antes y después del final del buffer)
+  size_t start = tail & ring->mask;
+  size_t first = ring->mask + 1 - start;
+  if (first > n) {
+    first = n;
+  }
+  memcpy(dst, &ring->buf[start], first * sizeof(int16_t));
+  memcpy(dst + first, &ring->buf[0], (n - first) * sizeof(int16_t));
+  if (dst_stamps != NULL && ring->stamps != NULL) {
+    memcpy(dst_stamps, &ring->stamps[start], first * sizeof(int64_t));
+    memcpy(dst_stamps + first, &ring->stamps[0], (n - first) * sizeof(int64_t));
+  }
+
+  // Liberar los lugares al productor
+  atomic_store_explicit(&ring->tail, tail + n, memory_order_release);
+
+  return n;
+}
+
+size_t sample_ring_count(sample_ring_t *ring)
+{
+  uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+  uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+  return head - tail;
+}
@@ -0,0 +1,77 @@
+/**
+ *
+ * Resumen:
+ * Medición de la telemetría binaria contra el camino actual de un printf por
+ * muestra: bytes por muestra, CPU por muestra y tiempo de línea a 115200 baudios.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "adc_source.h"
+#include "telemetry.h"
+#include "telemetry_bench.h"
+
+#include "bench_clock.h"
+
+// Configuración
+#define BENCH_SAMPLES     (4096)
+#define BENCH_BAUD        (115200)
+#define BENCH_PERIOD_US   (50)
+
+static int16_t samples[BENCH_SAMPLES];
+static uint8_t frame[TELEM_MAX_FRAME];
+static telem_enc_t enc;
+
+// Imprimir una línea de resultados
+static void bench_report(const char *name, size_t bytes, uint64_t us)
+{
+  // 10 bits por byte en la UART (inicio + 8 datos + parada)
+  double line_s = bytes * 10.0 / BENCH_BAUD;
+
+  printf("%-10s | bytes/muestra: %5.2f | us/muestra: %6.3f | muestras/s en línea: %7.0f\n",
+         name,
+         (double)bytes / BENCH_SAMPLES,
+         (double)us / BENCH_SAMPLES,
+         BENCH_SAMPLES / line_s);
+}
+
+void telem_benchmark(void)
+{
+  adc_source_t src;
+  adc_synth_t synth;
+  char text[8];
+  size_t bytes;
+  uint64_t t0, us;
+
+  adc_source_synth_init(&src, &synth, 0, 37, 2048, 1500, 50);
+  src.read_block(src.ctx, samples, BENCH_SAMPLES, 0, NULL);
+
+  printf("---Medición de telemetría (%d muestras)---\n", BENCH_SAMPLES);
+
+  // Camino actual: formatear cada muestra como texto (solo el costo de formato)
+  bytes = 0;
+  t0 = bench_now_us();
+  for (int i = 0; i < BENCH_SAMPLES; i++) {
+    bytes += snprintf(text, sizeof(text), "%d\n", samples[i]);
+  }
+  us = bench_now_us() - t0;
+  bench_report("printf", bytes, us);
+
+  // Tramas binarias con muestras int16 y con muestras de 12 bits empaquetadas
+  const uint8_t formats[] = { TELEM_FMT_I16, TELEM_FMT_U12 };
+  const char *names[] = { "binario16", "binario12" };
+  for (int f = 0; f < 2; f++) {
+    telem_enc_init(&enc, 0, formats[f]);
+    bytes = 0;
+    t0 = bench_now_us();
+    for (int i = 0; i < BENCH_SAMPLES; i += TELEM_MAX_SAMPLES) {
+      bytes += telem_encode(&enc, (uint64_t)i * BENCH_PERIOD_US, BENCH_PERIOD_US,
+                            &samples[i], TELEM_MAX_SAMPLES, frame);
+    }
+    us = bench_now_us() - t0;
+    bench_report(names[f], bytes, us);
+  }
+}
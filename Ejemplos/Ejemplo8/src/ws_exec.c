@@ -0,0 +1,312 @@
+/**
+ *
+ * Resumen:
+ * Implementación del ejecutor con robo de trabajo (ver ws_exec.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include "ws_exec.h"
+
+#define WS_MASK   (WS_DEQUE_LEN - 1)
+
+//*****************************************************************************
+// Deque por núcleo
+
+static bool deque_push(ws_core_t *c, const ws_job_t *job)
+{
+  bool ok;
+
+  portENTER_CRITICAL(&c->mux);
+  ok = (c->tail - c->head) < WS_DEQUE_LEN;
+  if (ok) {
+    c->jobs[c->tail & WS_MASK] = *job;
+    c->tail++;
+  }
+  portEXIT_CRITICAL(&c->mux);
+
+  return ok;
+}
+
+// Sacar del fondo (solo la dueña)
+static bool deque_pop(ws_core_t *c, ws_job_t *job)
+{
+  bool ok;
+
+  portENTER_CRITICAL(&c->mux);
+  ok = c->tail != c->head;
+  if (ok) {
+    c->tail--;
+    *job = c->jobs[c->tail & WS_MASK];
+  }
+  portEXIT_CRITICAL(&c->mux);
+
+  return ok;
+}
+
+// Robar el trabajo más viejo que no esté fijado a este núcleo
+static bool deque_steal(ws_core_t *c, ws_job_t *job)
+{
+  bool ok = false;
+
+  portENTER_CRITICAL(&c->mux);
+  for (uint32_t i = c->head; i != c->tail; i++) {
+    if (!c->jobs[i & WS_MASK].pinned) {
+      *job = c->jobs[i & WS_MASK];
+      // Correr los fijados que quedaron delante para cerrar el hueco
+      for (uint32_t j = i; j != c->head; j--) {
+        c->jobs[j & WS_MASK] = c->jobs[(j - 1) & WS_MASK];
+      }
+      c->head++;
+      ok = true;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&c->mux);
+
+  return ok;
+}
+
+//*****************************************************************************
+// Grupos
+
+static void group_add(ws_group_t *group)
+{
+  portENTER_CRITICAL(&group->mux);
+  group->pending++;
+  portEXIT_CRITICAL(&group->mux);
+}
+
+static void group_done(ws_group_t *group, bool notify)
+{
+  TaskHandle_t wake = NULL;
+
+  portENTER_CRITICAL(&group->mux);
+  group->pending--;
+  if (group->pending == 0 && notify) {
+    wake = group->waiter;         // Después de esto el grupo puede dejar de existir
+  }
+  portEXIT_CRITICAL(&group->mux);
+
+  if (wake != NULL) {
+    xTaskNotifyGive(wake);
+  }
+}
+
+void ws_group_wait(ws_group_t *group)
+{
+  while (1) {
+    portENTER_CRITICAL(&group->mux);
+    if (group->pending == 0) {
+      group->waiter = NULL;
+      portEXIT_CRITICAL(&group->mux);
+      return;
+    }
+    group->waiter = xTaskGetCurrentTaskHandle();
+    portEXIT_CRITICAL(&group->mux);
+
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+}
+
+//*****************************************************************************
+// Trabajadoras
+
+static void run_job(const ws_job_t *job)
+{
+  if (job->range_fn != NULL) {
+    job->range_fn(job->arg, job->lo, job->hi);
+  } else {
+    job->fn(job->arg);
+  }
+  if (job->group != NULL) {
+    group_done(job->group, true);
+  }
+}
+
+static bool take_job(ws_exec_t *ex, ws_core_t *me, ws_job_t *job)
+{
+  if (deque_pop(me, job)) {
+    return true;
+  }
+  for (int i = 0; i < portNUM_PROCESSORS; i++) {
+    if (&ex->core[i] != me && deque_steal(&ex->core[i], job)) {
+      me->stolen++;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void wsWorker(void *parameters)
+{
+  ws_exec_t *ex = (ws_exec_t *)parameters;
+  ws_core_t *me = &ex->core[xPortGetCoreID()];
+  ws_job_t job;
+
+  while (1) {
+    if (take_job(ex, me, &job)) {
+      run_job(&job);
+      me->executed++;
+      continue;
+    }
+
+    // Avisar que se va a dormir y volver a mirar: un trabajo encolado entre
+    // medio, o lo encuentra ahora, o quien lo encoló ve idle y la despierta
+    atomic_store(&me->idle, true);
+    if (take_job(ex, me, &job)) {
+      atomic_store(&me->idle, false);
+      run_job(&job);
+      me->executed++;
+      continue;
+    }
+    if (!ex->running) {
+      break;
+    }
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    atomic_store(&me->idle, false);
+  }
+
+  atomic_fetch_sub(&ex->alive, 1);
+  vTaskDelete(NULL);
+}
+
+// Despertar a la dueña de la deque o, si está ocupada, a otra que pueda robar
+static void wake_for(ws_exec_t *ex, int core, bool pinned)
+{
+  if (atomic_load(&ex->core[core].idle)) {
+    xTaskNotifyGive(ex->core[core].worker);
+    return;
+  }
+  if (pinned) {
+    return;
+  }
+  for (int i = 0; i < portNUM_PROCESSORS; i++) {
+    if (i != core && atomic_load(&ex->core[i].idle)) {
+      xTaskNotifyGive(ex->core[i].worker);
+      return;
+    }
+  }
+}
+
+static bool submit_job(ws_exec_t *ex, ws_job_t *job, ws_hint_t hint)
+{
+  int core = hint.core < 0 ? (int)xPortGetCoreID() : hint.core;
+
+  if (core >= portNUM_PROCESSORS) {
+    core = 0;
+  }
+  job->pinned = hint.pinned;
+
+  // Sumar antes de encolar: el trabajo puede terminar antes de volver
+  if (job->group != NULL) {
+    group_add(job->group);
+  }
+  if (!deque_push(&ex->core[core], job)) {
+    if (job->group != NULL) {
+      group_done(job->group, false);
+    }
+    return false;
+  }
+
+  wake_for(ex, core, job->pinned);
+  return true;
+}
+
+//*****************************************************************************
+// API
+
+bool ws_exec_init(ws_exec_t *ex, UBaseType_t priority, uint32_t stack_size)
+{
+  ex->running = true;
+  atomic_store(&ex->alive, 0);
+
+  for (int i = 0; i < portNUM_PROCESSORS; i++) {
+    ws_core_t *c = &ex->core[i];
+
+    portMUX_INITIALIZE(&c->mux);
+    c->head = 0;
+    c->tail = 0;
+    c->worker = NULL;
+    atomic_store(&c->idle, false);
+    c->executed = 0;
+    c->stolen = 0;
+  }
+
+  for (int i = 0; i < portNUM_PROCESSORS; i++) {
+    atomic_fetch_add(&ex->alive, 1);
+    if (xTaskCreatePinnedToCore(wsWorker, i == 0 ? "WS0" : "WS1", stack_size, ex,
+                                priority, &ex->core[i].worker, i) != pdPASS) {
+      atomic_fetch_sub(&ex->alive, 1);
+      ws_exec_stop(ex);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void ws_exec_stop(ws_exec_t *ex)
+{
+  ex->running = false;
+  for (int i = 0; i < portNUM_PROCESSORS; i++) {
+    if (ex->core[i].worker != NULL) {
+      xTaskNotifyGive(ex->core[i].worker);
+    }
+  }
+
+  // Las trabajadoras vacían sus deques antes de salir
+  while (atomic_load(&ex->alive) != 0) {
+    vTaskDelay(1);
+  }
+  for (int i = 0; i < portNUM_PROCESSORS; i++) {
+    ex->core[i].worker = NULL;
+  }
+}
+
+bool ws_submit(ws_exec_t *ex, ws_job_fn_t fn, void *arg, ws_hint_t hint, ws_group_t *group)
+{
+  ws_job_t job = {
+    .fn = fn,
+    .arg = arg,
+    .group = group,
+  };
+
+  return submit_job(ex, &job, hint);
+}
+
+void ws_parallel_for(ws_exec_t *ex, size_t begin, size_t end, size_t grain,
+                     ws_range_fn_t fn, void *ctx)
+{
+  ws_group_t group;
+  size_t chunks;
+  size_t i = 0;
+
+  if (grain == 0) {
+    grain = 1;
+  }
+  if (end <= begin) {
+    return;
+  }
+  chunks = (end - begin + grain - 1) / grain;
+  ws_group_init(&group);
+
+  for (size_t lo = begin; lo < end; lo += grain, i++) {
+    ws_job_t job = {
+      .range_fn = fn,
+      .arg = ctx,
+      .lo = lo,
+      .hi = (end - lo > grain) ? lo + grain : end,
+      .group = &group,
+    };
+
+    // Trozos contiguos en cada núcleo; el que se desocupa antes roba
+    int core = (int)(i * portNUM_PROCESSORS / chunks);
+    if (!submit_job(ex, &job, WS_PREFER(core))) {
+      fn(ctx, job.lo, job.hi);
+    }
+  }
+
+  ws_group_wait(&group);
+}
@@ -0,0 +1,185 @@
+/**
+ *
+ * Resumen:
+ * Medición de aceleración del ejecutor con robo de trabajo sobre un filtrado
+ * por bloques de BENCH_CHANNELS canales (promedio móvil + FIR con decimación +
+ * estadísticas, con estado propio por canal):
+ * - el modelo actual: una tarea fijada a app_cpu procesa todos los canales;
+ * - ws_parallel_for: un trozo por canal, repartidos entre los dos núcleos;
+ * - todos los canales encolados en app_cpu con WS_PREFER: el otro núcleo
+ *   solo participa robando.
+ * Los resultados de cada forma se comparan contra los del modelo actual.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "adc_source.h"
+#include "dsp.h"
+#include "ws_exec.h"
+
+// Configuración
+#define BENCH_CHANNELS    (8)
+#define BENCH_BLOCK       (256)     // Muestras por bloque y canal
+#define BENCH_ROUNDS      (50)      // Bloques procesados por canal
+#define BENCH_MAVG_LOG2   (3)
+#define BENCH_FIR_TAPS    (32)
+#define BENCH_FIR_DECIM   (4)
+#define BENCH_PRIO        (5)
+
+#if CONFIG_FREERTOS_UNICORE
+  #define BENCH_APP_CPU   (0)
+#else
+  #define BENCH_APP_CPU   (1)
+#endif
+
+typedef enum {
+  METHOD_PINNED,
+  METHOD_PARALLEL_FOR,
+  METHOD_STEAL,
+  METHOD_COUNT,
+} bench_method_t;
+
+static const char *const method_name[] = { "fijado a app_cpu", "ws_parallel_for", "todo en app_cpu + robo" };
+
+// Estado grande fuera de la pila de las tareas
+static int16_t input[BENCH_CHANNELS][BENCH_BLOCK];
+static int16_t filtered[BENCH_CHANNELS][BENCH_BLOCK];
+static int16_t decimated[BENCH_CHANNELS][BENCH_BLOCK / BENCH_FIR_DECIM + 1];
+static int16_t coef[BENCH_FIR_TAPS];
+static dsp_mavg_t mavg[BENCH_CHANNELS];
+static dsp_fir_t fir[BENCH_CHANNELS];
+static dsp_stats_t result[METHOD_COUNT][BENCH_CHANNELS];
+static size_t channel_idx[BENCH_CHANNELS];
+
+static bench_method_t method;
+static ws_exec_t ex;
+static SemaphoreHandle_t done_sem;
+static int64_t elapsed_us;
+
+// Procesar un bloque de los canales [lo, hi)
+static void filter_channels(void *ctx, size_t lo, size_t hi)
+{
+  dsp_stats_t *out = (dsp_stats_t *)ctx;
+
+  for (size_t ch = lo; ch < hi; ch++) {
+    dsp_mavg(&mavg[ch], input[ch], filtered[ch], BENCH_BLOCK);
+    size_t n = dsp_fir_decim(&fir[ch], filtered[ch], decimated[ch], BENCH_BLOCK);
+    dsp_stats(decimated[ch], n, &out[ch]);
+  }
+}
+
+static void filter_one(void *arg)
+{
+  size_t ch = *(size_t *)arg;
+
+  filter_channels(result[METHOD_STEAL], ch, ch + 1);
+}
+
+// Corre en app_cpu, como la tarea de procesamiento de main.c
+static void benchRunner(void *parameters)
+{
+  ws_group_t group;
+  int64_t t0 = esp_timer_get_time();
+
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    switch (method) {
+      case METHOD_PINNED:
+        filter_channels(result[METHOD_PINNED], 0, BENCH_CHANNELS);
+        break;
+      case METHOD_PARALLEL_FOR:
+        ws_parallel_for(&ex, 0, BENCH_CHANNELS, 1, filter_channels, result[METHOD_PARALLEL_FOR]);
+        break;
+      case METHOD_STEAL:
+      default:
+        ws_group_init(&group);
+        for (int ch = 0; ch < BENCH_CHANNELS; ch++) {
+          if (!ws_submit(&ex, filter_one, &channel_idx[ch], WS_PREFER(BENCH_APP_CPU), &group)) {
+            filter_one(&channel_idx[ch]);
+          }
+        }
+        ws_group_wait(&group);
+        break;
+    }
+  }
+
+  elapsed_us = esp_timer_get_time() - t0;
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+static void bench_run(bench_method_t m, int64_t base_us)
+{
+  uint32_t executed[portNUM_PROCESSORS];
+  uint32_t stolen[portNUM_PROCESSORS];
+
+  // Mismo estado inicial en cada forma
+  for (int ch = 0; ch < BENCH_CHANNELS; ch++) {
+    dsp_mavg_init(&mavg[ch], BENCH_MAVG_LOG2);
+    dsp_fir_init(&fir[ch], coef, BENCH_FIR_TAPS, BENCH_FIR_DECIM);
+  }
+  for (int i = 0; i < portNUM_PROCESSORS; i++) {
+    executed[i] = ex.core[i].executed;
+    stolen[i] = ex.core[i].stolen;
+  }
+
+  method = m;
+  xTaskCreatePinnedToCore(benchRunner, "Proceso", 3072, NULL, BENCH_PRIO - 1, NULL, BENCH_APP_CPU);
+  xSemaphoreTake(done_sem, portMAX_DELAY);
+
+  bool ok = memcmp(result[m], result[METHOD_PINNED], sizeof(result[m])) == 0;
+  printf("%-22s | %7.0f muestras/s | x%.2f | %s",
+         method_name[m],
+         (double)BENCH_CHANNELS * BENCH_BLOCK * BENCH_ROUNDS * 1e6 / (double)(elapsed_us ? elapsed_us : 1),
+         elapsed_us ? (double)(base_us ? base_us : elapsed_us) / elapsed_us : 0.0,
+         ok ? "OK" : "DIFIERE");
+  if (m != METHOD_PINNED) {
+    for (int i = 0; i < portNUM_PROCESSORS; i++) {
+      printf(" | núcleo %d: %lu trabajos, %lu robados", i,
+             (unsigned long)(ex.core[i].executed - executed[i]),
+             (unsigned long)(ex.core[i].stolen - stolen[i]));
+    }
+  }
+  printf("\n");
+
+  vTaskDelay(1);
+}
+
+void ws_exec_benchmark(void)
+{
+  adc_source_t src;
+  adc_synth_t synth;
+  int64_t base_us;
+
+  // Entrada: una senoidal sintética distinta por canal
+  for (int ch = 0; ch < BENCH_CHANNELS; ch++) {
+    adc_source_synth_init(&src, &synth, 0, 37 + 11 * ch, 2048, 1500, 50);
+    src.read_block(src.ctx, input[ch], BENCH_BLOCK, 0, NULL);
+    channel_idx[ch] = ch;
+  }
+  dsp_fir_design_lowpass(coef, BENCH_FIR_TAPS, 0.5f / BENCH_FIR_DECIM);
+
+  done_sem = xSemaphoreCreateBinary();
+  if (!ws_exec_init(&ex, BENCH_PRIO, 3072)) {
+    printf("No se pudo crear el ejecutor\n");
+    vSemaphoreDelete(done_sem);
+    return;
+  }
+
+  printf("---Medición robo de trabajo (%d canales x %d bloques de %d muestras)---\n",
+         BENCH_CHANNELS, BENCH_ROUNDS, BENCH_BLOCK);
+
+  bench_run(METHOD_PINNED, 0);
+  base_us = elapsed_us;
+  bench_run(METHOD_PARALLEL_FOR, base_us);
+  bench_run(METHOD_STEAL, base_us);
+
+  ws_exec_stop(&ex);
+  vSemaphoreDelete(done_sem);
+}
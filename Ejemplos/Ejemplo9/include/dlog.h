@@ -0,0 +1,113 @@
+/**
+ *
+ * Resumen:
+ * Registro con formato diferido (dlog). En lugar de formatear texto con
+ * printf en la tarea, se guarda en un anillo solo el identificador de la
+ * cadena de formato (ver dlog_fmt.def) y los argumentos crudos. Una tarea de
+ * baja prioridad vuelca el anillo como binario por la consola y la
+ * herramienta de host tools/dlog_decode.c arma el texto.
+ *
+ * Registro en el anillo (palabras de 32 bits):
+ *   id(8) | argumentos(8) | tiempo_ms(16)    seguido de un argumento por palabra
+ *
+ * Registro en la salida (enteros en LEB128, 1 a 5 bytes c/u):
+ *   0xA5  id(1)  ms desde el registro anterior  argumentos  crc8(1)
+ *
+ * - El CRC-8 (polinomio 0x07) cubre desde id hasta el último argumento. El
+ *   0xA5 puede aparecer dentro de un argumento o del texto de consola: un
+ *   sincronismo falso no pasa la verificación y el decodificador sigue
+ *   buscando desde el byte siguiente.
+ *
+ * - dlog_write() es apta para tareas e ISR de ambos núcleos (sección crítica
+ *   corta); si no hay lugar el registro se descarta y se cuenta.
+ * - El tiempo se guarda en ms y 16 bits y sale como diferencia con el registro
+ *   anterior (normalmente 1 byte); no debe haber más de 65 s entre registros.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef DLOG_H
+#define DLOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define DLOG_RING_WORDS     (256)   // Capacidad del anillo (potencia de 2)
+#define DLOG_MAX_ARGS       (4)
+#define DLOG_SYNC           (0xA5)  // Primer byte de cada registro en la salida
+#define DLOG_MAX_REC        (2 + 3 + 5 * DLOG_MAX_ARGS + 1)   // Registro más largo en la salida
+
+// Identificadores generados a partir de la tabla
+typedef enum {
+#define DLOG_FMT(name, nargs, fmt)  DLOG_##name,
+#include "dlog_fmt.def"
+#undef DLOG_FMT
+  DLOG_COUNT
+} dlog_id_t;
+
+// Tabla de formatos y cantidad de argumentos (también la usa el host)
+extern const char *const dlog_fmt[DLOG_COUNT];
+extern const uint8_t dlog_nargs[DLOG_COUNT];
+
+// CRC-8 de un registro de la salida (también lo usa el host)
+static inline uint8_t dlog_crc8(const uint8_t *data, size_t len)
+{
+  uint8_t crc = 0;
+
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int b = 0; b < 8; b++) {
+      crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+// Estadísticas
+typedef struct {
+  uint32_t written;     // Registros guardados
+  uint32_t dropped;     // Registros descartados por anillo lleno
+  uint32_t bytes;       // Bytes emitidos por dlog_flush
+} dlog_stats_t;
+
+/**
+ * @brief Guardar un registro: solo identificador y argumentos, sin formatear
+ *
+ * Usar a través de DLOG(); `args` debe tener DLOG_MAX_ARGS palabras.
+ */
+void dlog_write(dlog_id_t id, const uint32_t *args);
+
+/**
+ * @brief Formatear en el dispositivo con la misma tabla (modo texto)
+ */
+void dlog_print(dlog_id_t id, const uint32_t *args);
+
+#define DLOG(id, ...)         dlog_write((id), (const uint32_t[DLOG_MAX_ARGS]){ __VA_ARGS__ })
+#define DLOG_PRINT(id, ...)   dlog_print((id), (const uint32_t[DLOG_MAX_ARGS]){ __VA_ARGS__ })
+
+/**
+ * @brief Volcar los registros pendientes como binario por stdout (un solo consumidor)
+ *
+ * @return Bytes emitidos
+ */
+size_t dlog_flush(void);
+
+/**
+ * @brief Bytes que ocuparían en la salida los registros pendientes
+ */
+size_t dlog_pending_bytes(void);
+
+/**
+ * @brief Descartar los registros pendientes y poner a cero las estadísticas
+ */
+void dlog_reset(void);
+
+void dlog_get_stats(dlog_stats_t *stats);
+
+/**
+ * @brief Comparar el costo por llamada y los bytes por registro contra printf
+ */
+void dlog_benchmark(void);
+
+#endif // DLOG_H
@@ -0,0 +1,181 @@
+/**
+ *
+ * Resumen:
+ * Implementación del registro con formato diferido (ver dlog.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdatomic.h>
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "dlog.h"
+
+#include "bench_clock.h"
+#define dlog_now_ms()     ((uint32_t)(bench_now_us() / 1000))
+
+#define DLOG_MASK         (DLOG_RING_WORDS - 1)
+
+// Tablas generadas a partir de dlog_fmt.def
+const char *const dlog_fmt[DLOG_COUNT] = {
+#define DLOG_FMT(name, nargs, fmt)  fmt,
+#include "dlog_fmt.def"
+#undef DLOG_FMT
+};
+
+const uint8_t dlog_nargs[DLOG_COUNT] = {
+#define DLOG_FMT(name, nargs, fmt)  nargs,
+#include "dlog_fmt.def"
+#undef DLOG_FMT
+};
+
+// Anillo: los productores escriben bajo el spinlock, el volcado solo lee
+static uint32_t ring[DLOG_RING_WORDS];
+static _Atomic uint32_t head;
+static _Atomic uint32_t tail;
+static portMUX_TYPE dlog_lock = portMUX_INITIALIZER_UNLOCKED;
+static dlog_stats_t stats;
+static uint16_t last_ms;          // Tiempo del último registro emitido (solo el volcado)
+
+void dlog_write(dlog_id_t id, const uint32_t *args)
+{
+  uint32_t n = dlog_nargs[id];
+  uint32_t hdr = (uint32_t)id | (n << 8) | (dlog_now_ms() << 16);
+
+  portENTER_CRITICAL_SAFE(&dlog_lock);
+  uint32_t h = atomic_load_explicit(&head, memory_order_relaxed);
+  uint32_t t = atomic_load_explicit(&tail, memory_order_acquire);
+
+  if (DLOG_RING_WORDS - (h - t) < n + 1) {
+    stats.dropped++;
+  } else {
+    ring[h & DLOG_MASK] = hdr;
+    for (uint32_t i = 0; i < n; i++) {
+      ring[(h + 1 + i) & DLOG_MASK] = args[i];
+    }
+    atomic_store_explicit(&head, h + n + 1, memory_order_release);
+    stats.written++;
+  }
+  portEXIT_CRITICAL_SAFE(&dlog_lock);
+}
+
+void dlog_print(dlog_id_t id, const uint32_t *args)
+{
+  printf(dlog_fmt[id], args[0], args[1], args[2], args[3]);
+}
+
+// Argumento en LEB128: 7 bits por byte, el bit alto indica que sigue otro
+static inline size_t put_varint(uint8_t *out, uint32_t v)
+{
+  size_t n = 0;
+
+  while (v >= 0x80) {
+    out[n++] = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  out[n++] = (uint8_t)v;
+  return n;
+}
+
+static inline size_t varint_len(uint32_t v)
+{
+  size_t n = 1;
+
+  while (v >= 0x80) {
+    v >>= 7;
+    n++;
+  }
+  return n;
+}
+
+size_t dlog_flush(void)
+{
+  uint8_t out[64];
+  size_t len = 0;
+  size_t total = 0;
+  uint32_t t = atomic_load_explicit(&tail, memory_order_relaxed);
+  uint32_t h = atomic_load_explicit(&head, memory_order_acquire);
+
+  while (t != h) {
+    uint32_t hdr = ring[t & DLOG_MASK];
+    uint32_t n = (hdr >> 8) & 0xFF;
+
+    // Vaciar el buffer si el próximo registro no entra
+    if (len + DLOG_MAX_REC > sizeof(out)) {
+      fwrite(out, 1, len, stdout);
+      total += len;
+      len = 0;
+    }
+
+    uint16_t ms = (uint16_t)(hdr >> 16);
+    out[len++] = DLOG_SYNC;
+    size_t start = len;
+    out[len++] = (uint8_t)hdr;
+    len += put_varint(&out[len], (uint16_t)(ms - last_ms));
+    last_ms = ms;
+    for (uint32_t i = 0; i < n; i++) {
+      len += put_varint(&out[len], ring[(t + 1 + i) & DLOG_MASK]);
+    }
+    out[len] = dlog_crc8(&out[start], len - start);
+    len++;
+    t += n + 1;
+  }
+
+  // Liberar el espacio recién después de copiarlo
+  atomic_store_explicit(&tail, t, memory_order_release);
+
+  if (len > 0) {
+    fwrite(out, 1, len, stdout);
+    total += len;
+  }
+  if (total > 0) {
+    fflush(stdout);
+  }
+
+  // Las estadísticas se leen y se ponen a cero bajo el mismo spinlock
+  portENTER_CRITICAL_SAFE(&dlog_lock);
+  stats.bytes += total;
+  portEXIT_CRITICAL_SAFE(&dlog_lock);
+
+  return total;
+}
+
+size_t dlog_pending_bytes(void)
+{
+  size_t total = 0;
+  uint16_t prev = last_ms;
+  uint32_t t = atomic_load_explicit(&tail, memory_order_relaxed);
+  uint32_t h = atomic_load_explicit(&head, memory_order_acquire);
+
+  while (t != h) {
+    uint32_t hdr = ring[t & DLOG_MASK];
+    uint32_t n = (hdr >> 8) & 0xFF;
+    uint16_t ms = (uint16_t)(hdr >> 16);
+
+    total += 3 + varint_len((uint16_t)(ms - prev));     // Sincronismo, id y CRC
+    prev = ms;
+    for (uint32_t i = 0; i < n; i++) {
+      total += varint_len(ring[(t + 1 + i) & DLOG_MASK]);
+    }
+    t += n + 1;
+  }
+  return total;
+}
+
+void dlog_reset(void)
+{
+  portENTER_CRITICAL_SAFE(&dlog_lock);
+  atomic_store_explicit(&tail, atomic_load_explicit(&head, memory_order_relaxed), memory_order_release);
+  stats.written = 0;
+  stats.dropped = 0;
+  stats.bytes = 0;
+  portEXIT_CRITICAL_SAFE(&dlog_lock);
+}
+
+void dlog_get_stats(dlog_stats_t *out)
+{
+  portENTER_CRITICAL_SAFE(&dlog_lock);
+  *out = stats;
+  portEXIT_CRITICAL_SAFE(&dlog_lock);
+}
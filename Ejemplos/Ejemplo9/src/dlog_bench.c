@@ -0,0 +1,103 @@
+/**
+ *
+ * Resumen:
+ * Medición del registro diferido contra printf: costo por llamada en la
+ * tarea (ciclos) y bytes por registro en la salida, con un mensaje fijo como
+ * los del ejemplo y con un entero como printf("%d\n", item).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "dlog.h"
+
+#include "bench_clock.h"
+
+// Configuración
+#define BENCH_CALLS     (100)   // Llamadas por caso (entran en el anillo)
+
+// Imprimir una línea de resultados
+static void bench_report(const char *name, uint32_t ticks, uint32_t bytes)
+{
+  printf("%-18s | %s/llamada: %8.1f | bytes/registro: %5.1f\n",
+         name, BENCH_TICK_UNIT, (double)ticks / BENCH_CALLS, (double)bytes / BENCH_CALLS);
+}
+
+void dlog_benchmark(void)
+{
+  char buf[48];
+  uint32_t t0, printf_ticks, snprintf_ticks, dlog_ticks;
+  uint32_t text_bytes = 0;
+  uint32_t dlog_bytes;
+  dlog_stats_t st;
+
+  // Mensaje fijo ------------------------------------------------------------
+  t0 = bench_ticks();
+  for (int i = 0; i < BENCH_CALLS; i++) {
+    printf("Tarea A tomó mutex 1\n");
+  }
+  printf_ticks = bench_ticks() - t0;
+  fflush(stdout);
+
+  t0 = bench_ticks();
+  for (int i = 0; i < BENCH_CALLS; i++) {
+    text_bytes += snprintf(buf, sizeof(buf), "Tarea A tomó mutex 1\n");
+  }
+  snprintf_ticks = bench_ticks() - t0;
+
+  dlog_reset();
+  t0 = bench_ticks();
+  for (int i = 0; i < BENCH_CALLS; i++) {
+    DLOG(DLOG_A_TOMO_M1);
+  }
+  dlog_ticks = bench_ticks() - t0;
+  dlog_get_stats(&st);
+  dlog_bytes = dlog_pending_bytes();
+  dlog_reset();
+
+  printf("\n---Medición dlog: mensaje fijo (%d llamadas)---\n", BENCH_CALLS);
+  bench_report("printf", printf_ticks, text_bytes);
+  bench_report("snprintf (formato)", snprintf_ticks, text_bytes);
+  bench_report("dlog", dlog_ticks, dlog_bytes);
+  printf("descartados: %lu | mejora vs printf: %.1fx tiempo, %.1fx bytes\n",
+         (unsigned long)st.dropped,
+         dlog_ticks ? (double)printf_ticks / dlog_ticks : 0.0,
+         dlog_bytes ? (double)text_bytes / dlog_bytes : 0.0);
+
+  // Entero ------------------------------------------------------------------
+  text_bytes = 0;
+  t0 = bench_ticks();
+  for (int i = 0; i < BENCH_CALLS; i++) {
+    printf("%d\n", i * 37);
+  }
+  printf_ticks = bench_ticks() - t0;
+  fflush(stdout);
+
+  t0 = bench_ticks();
+  for (int i = 0; i < BENCH_CALLS; i++) {
+    text_bytes += snprintf(buf, sizeof(buf), "%d\n", i * 37);
+  }
+  snprintf_ticks = bench_ticks() - t0;
+
+  dlog_reset();
+  t0 = bench_ticks();
+  for (int i = 0; i < BENCH_CALLS; i++) {
+    DLOG(DLOG_BENCH_INT, (uint32_t)(i * 37));
+  }
+  dlog_ticks = bench_ticks() - t0;
+  dlog_get_stats(&st);
+  dlog_bytes = dlog_pending_bytes();
+  dlog_reset();
+
+  printf("\n---Medición dlog: entero (%d llamadas)---\n", BENCH_CALLS);
+  bench_report("printf", printf_ticks, text_bytes);
+  bench_report("snprintf (formato)", snprintf_ticks, text_bytes);
+  bench_report("dlog", dlog_ticks, dlog_bytes);
+  printf("descartados: %lu | mejora vs printf: %.1fx tiempo, %.1fx bytes\n",
+         (unsigned long)st.dropped,
+         dlog_ticks ? (double)printf_ticks / dlog_ticks : 0.0,
+         dlog_bytes ? (double)text_bytes / dlog_bytes : 0.0);
+}
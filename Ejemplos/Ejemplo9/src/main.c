@@ -2,6 +2,11 @@
  * 
  * Resumen:
  * Demostrar un deadlock con 2 tareas.
+ * Los mensajes de las tareas pasan por dlog: con DLOG_EN solo se guarda el
+ * identificador de cada cadena y una tarea de baja prioridad los vuelca en
+ * binario para decodificarlos en el host con tools/dlog_decode.c.
+ * Con LOG_MUX_EN cada mensaje es un registro completo en log_mux y una tarea
+ * de drenado lo imprime con marca de tiempo, tarea y núcleo.
  * Documentacion: https://www.digikey.com/en/maker/projects/introduction-to-rtos-solution-to-part-10-deadlock-and-starvation/872c6a057901432e84594d79fcb2cc5d
  *
  * Configuración GPIO:
@@ -13,13 +18,57 @@
  */
 // Probablemente necesitarás esto en FreeRTOS estándar
 //#include <semphr.h>
+#include <stdio.h>
 #include "freertos/FreeRTOS.h"
+#include "dlog.h"
+#include "log_mux.h"
+#include "lock_prof.h"
+#include "stack_prof.h"
 
 // Define uno para seleccionar la ejecución del código
 #define DEADLOCK_EN
 //#define DEADLOCK_TIMEOUT
 //#define DEADLOCK_HIERARCHY
 
+// Descomentar para registrar con formato diferido (ver tools/dlog_decode.c)
+//#define DLOG_EN
+
+// Descomentar para comparar dlog contra printf al iniciar
+//#define DLOG_BENCH_EN
+
+// Descomentar para que cada mensaje sea un registro completo en log_mux en lugar de un printf
+//#define LOG_MUX_EN
+
+#if defined(DLOG_EN) && defined(LOG_MUX_EN)
+#error "DLOG_EN y LOG_MUX_EN son dos formas de registrar, elegir una"
+#endif
+
+#ifdef DLOG_EN
+  #define LOG_INIT()
+  #define LOG(id, ...)  DLOG(id, ##__VA_ARGS__)
+#elif defined(LOG_MUX_EN)
+  #define LOG_INIT()    uint8_t log_src = log_mux_register_self(&log_mux)
+  #define LOG(id, ...)  log_mux_printf(&log_mux, log_src, dlog_fmt[id], ##__VA_ARGS__)
+#else
+  #define LOG_INIT()
+  #define LOG(id, ...)  DLOG_PRINT(id, ##__VA_ARGS__)
+#endif
+
+// Descomentar para medir la contención de los bloqueos (reporte con 'l' o cada LOCK_PROF_DUMP_MS)
+//#define LOCK_PROF_EN
+#define LOCK_PROF_DUMP_MS 10000
+
+// Descomentar para informar periódicamente el peor caso de pila de todas las tareas
+//#define STACK_PROF_EN
+
+#ifdef LOCK_PROF_EN
+  #define TAKE(sem, ticks)  lock_prof_take(sem, ticks)
+  #define GIVE(sem)         lock_prof_give(sem)
+#else
+  #define TAKE(sem, ticks)  xSemaphoreTake(sem, ticks)
+  #define GIVE(sem)         xSemaphoreGive(sem)
+#endif
+
 // Usar solo el núcleo 1 para propósitos de demostración
 #if CONFIG_FREERTOS_UNICORE
   static const BaseType_t app_cpu = 0;
@@ -33,12 +82,19 @@ TickType_t mutex_timeout = 1000 / portTICK_PERIOD_MS;
 // Variables globales
 static SemaphoreHandle_t mutex_1;
 static SemaphoreHandle_t mutex_2;
+#ifdef LOG_MUX_EN
+// Multiplexor de registros: las tareas producen y solo el drenado escribe en la consola
+static log_mux_t log_mux;
+static uart_tx_backend_t log_be;
+static uart_tx_stage_t log_stage;
+#endif
 
 //*****************************************************************************
 // Tareas
 
 // Tarea A (alta prioridad)
 void doTaskA(void *parameters) {
+  LOG_INIT();
 
   // Bucle infinito
   while (1) {
@@ -46,77 +102,77 @@ void doTaskA(void *parameters) {
     #ifdef DEADLOCK_EN  // Deadlock habilitado
 
         // Tomar el mutex 1 (introduce espera para forzar el deadlock)
-        xSemaphoreTake(mutex_1, portMAX_DELAY);
-        printf("Tarea A tomó mutex 1\n");
+        TAKE(mutex_1, portMAX_DELAY);
+        LOG(DLOG_A_TOMO_M1);
         vTaskDelay(100 / portTICK_PERIOD_MS);
 
         // Tomar el mutex 2
-        xSemaphoreTake(mutex_2, portMAX_DELAY);
-        printf("Tarea A tomó mutex 2\n");
+        TAKE(mutex_2, portMAX_DELAY);
+        LOG(DLOG_A_TOMO_M2);
 
         // Sección crítica protegida por 2 mutexes
-        printf("Tarea A haciendo algún trabajo\n");
+        LOG(DLOG_A_TRABAJO);
         vTaskDelay(500 / portTICK_PERIOD_MS);
 
         // Devolver mutexes
-        xSemaphoreGive(mutex_2);
-        xSemaphoreGive(mutex_1);
+        GIVE(mutex_2);
+        GIVE(mutex_1);
         // Esperar para dejar que la otra tarea se ejecute
-        printf("Tarea A se va a dormir\n");
+        LOG(DLOG_A_DUERME);
         vTaskDelay(500 / portTICK_PERIOD_MS);
 
     #elif defined(DEADLOCK_TIMEOUT)   // Deadlock deshabilitado con timeout
         // Tomar el mutex 1
-        if (xSemaphoreTake(mutex_1, mutex_timeout) == pdTRUE) {
+        if (TAKE(mutex_1, mutex_timeout) == pdTRUE) {
 
         // Indicar que tomamos el mutex 1 y esperar (para forzar el deadlock)
-        printf("Tarea A tomó mutex 1\n");
+        LOG(DLOG_A_TOMO_M1);
         vTaskDelay(1 / portTICK_PERIOD_MS);
     
         // Tomar el mutex 2
-        if (xSemaphoreTake(mutex_2, mutex_timeout) == pdTRUE) {
+        if (TAKE(mutex_2, mutex_timeout) == pdTRUE) {
 
             // Indicar que tomamos el mutex 2
-            printf("Tarea A tomó mutex 2\n");
+            LOG(DLOG_A_TOMO_M2);
     
             // Sección crítica protegida por 2 mutexes
-            printf("Tarea A haciendo algún trabajo\n");
+            LOG(DLOG_A_TRABAJO);
             vTaskDelay(500 / portTICK_PERIOD_MS);
         } else {
-            printf("Tarea A se agotó esperando por el mutex 2\n");
+            LOG(DLOG_A_TIMEOUT_M2);
         }
         } else {
-        printf("Tarea A se agotó esperando por el mutex 1\n");
+        LOG(DLOG_A_TIMEOUT_M1);
         }
 
         // Devolver mutexes
-        xSemaphoreGive(mutex_2);
-        xSemaphoreGive(mutex_1);
+        GIVE(mutex_2);
+        GIVE(mutex_1);
 
         // Esperar para dejar que la otra tarea se ejecute
-        printf("Tarea A se va a dormir\n");
+        LOG(DLOG_A_DUERME);
         vTaskDelay(500 / portTICK_PERIOD_MS);
     
     #elif defined(DEADLOCK_HIERARCHY)   // Deadlock deshabilitado usando jerarquía de semáforos
         // Tomar el mutex 1 (introduce espera para forzar el deadlock)
-        xSemaphoreTake(mutex_1, portMAX_DELAY);
-        printf("Tarea A tomó mutex 1\n");
+        TAKE(mutex_1, portMAX_DELAY);
+        LOG(DLOG_A_TOMO_M1);
         vTaskDelay(1 / portTICK_PERIOD_MS);
 
         // Tomar el mutex 2
-        xSemaphoreTake(mutex_2, portMAX_DELAY);
-        printf("Tarea A tomó mutex 2\n");
+        TAKE(mutex_2, portMAX_DELAY);
+        LOG(DLOG_A_TOMO_M2);
 
         // Sección crítica protegida por 2 mutexes
-        printf("Tarea A haciendo algún trabajo\n");
+        LOG(DLOG_A_TRABAJO);
         vTaskDelay(500 / portTICK_PERIOD_MS);
 
         // Devolver mutexes (en orden inverso al que los tomamos)
-        xSemaphoreGive(mutex_2);
-        xSemaphoreGive(mutex_1);
+        GIVE(mutex_2);
+        GIVE(mutex_1);
 
         // Esperar para dejar que la otra tarea se ejecute
-        printf("Tarea A se va a dormir\n");
+        LOG(DLOG_A_DUERME);
         vTaskDelay(500 / portTICK_PERIOD_MS);
     #endif
   }
@@ -124,103 +180,138 @@ void doTaskA(void *parameters) {
 
 // Tarea B (baja prioridad)
 void doTaskB(void *parameters) {
+  LOG_INIT();
 
   // Bucle infinito
   while (1) {
     #if defined(DEADLOCK_EN)  // Deadlock habilitado
 
         // Tomar el mutex 2 (introduce espera para forzar el deadlock)
-        xSemaphoreTake(mutex_2, portMAX_DELAY);
-        printf("Tarea B tomó mutex 2\n");
+        TAKE(mutex_2, portMAX_DELAY);
+        LOG(DLOG_B_TOMO_M2);
         vTaskDelay(100 / portTICK_PERIOD_MS);
 
         // Tomar el mutex 1
-        xSemaphoreTake(mutex_1, portMAX_DELAY);
-        printf("Tarea B tomó mutex 1\n");
+        TAKE(mutex_1, portMAX_DELAY);
+        LOG(DLOG_B_TOMO_M1);
 
         // Sección crítica protegida por 2 mutexes
-        printf("Tarea B haciendo algún trabajo\n");
+        LOG(DLOG_B_TRABAJO);
         vTaskDelay(500 / portTICK_PERIOD_MS);
 
         // Devolver mutexes
-        xSemaphoreGive(mutex_1);
-        xSemaphoreGive(mutex_2);
+        GIVE(mutex_1);
+        GIVE(mutex_2);
         // Esperar para dejar que la otra tarea se ejecute
-        printf("Tarea A se va a dormir\n");
+        LOG(DLOG_B_DUERME);
         vTaskDelay(500 / portTICK_PERIOD_MS);
 
     #elif defined(DEADLOCK_TIMEOUT)   // Deadlock deshabilitado usando timeouts
     
         // Tomar el mutex 2
-        if (xSemaphoreTake(mutex_2, mutex_timeout) == pdTRUE) {
+        if (TAKE(mutex_2, mutex_timeout) == pdTRUE) {
 
         // Indicar que tomamos el mutex 2 y esperar (para forzar el deadlock)
-        printf("Tarea B tomó mutex 2\n");
+        LOG(DLOG_B_TOMO_M2);
         vTaskDelay(1 / portTICK_PERIOD_MS);
     
         // Tomar el mutex 1
-        if (xSemaphoreTake(mutex_1, mutex_timeout) == pdTRUE) {
+        if (TAKE(mutex_1, mutex_timeout) == pdTRUE) {
 
             // Indicar que tomamos el mutex 1
-            printf("Tarea B tomó mutex 1\n");
+            LOG(DLOG_B_TOMO_M1);
     
             // Sección crítica protegida por 2 mutexes
-            printf("Tarea B haciendo algún trabajo\n");
+            LOG(DLOG_B_TRABAJO);
             vTaskDelay(500 / portTICK_PERIOD_MS);
         } else {
-            printf("Tarea B se agotó esperando por el mutex 1\n");
+            LOG(DLOG_B_TIMEOUT_M1);
         }
         } else {
-        printf("Tarea B se agotó esperando por el mutex 2\n");
+        LOG(DLOG_B_TIMEOUT_M2);
         }
 
         // Devolver mutexes
-        xSemaphoreGive(mutex_1);
-        xSemaphoreGive(mutex_2);
+        GIVE(mutex_1);
+        GIVE(mutex_2);
 
         // Esperar para dejar que la otra tarea se ejecute
-        printf("Tarea B se va a dormir\n");
+        LOG(DLOG_B_DUERME);
         vTaskDelay(500 / portTICK_PERIOD_MS);
         
     #elif defined(DEADLOCK_HIERARCHY)   // Deadlock deshabilitado usando jerarquía de semáforos
         // Tomar el mutex 1 (introduce espera para forzar el deadlock)
-        xSemaphoreTake(mutex_1, portMAX_DELAY);
-        printf("Tarea B tomó mutex 1\n");
+        TAKE(mutex_1, portMAX_DELAY);
+        LOG(DLOG_B_TOMO_M1);
         vTaskDelay(1 / portTICK_PERIOD_MS);
 
         // Tomar el mutex 2
-        xSemaphoreTake(mutex_2, portMAX_DELAY);
-        printf("Tarea B tomó mutex 2\n");
+        TAKE(mutex_2, portMAX_DELAY);
+        LOG(DLOG_B_TOMO_M2);
 
         // Sección crítica protegida por 2 mutexes
-        printf("Tarea B haciendo algún trabajo\n");
+        LOG(DLOG_B_TRABAJO);
         vTaskDelay(500 / portTICK_PERIOD_MS);
 
         // Devolver mutexes (en orden inverso al que los tomamos)
-        xSemaphoreGive(mutex_2);
-        xSemaphoreGive(mutex_1);
+        GIVE(mutex_2);
+        GIVE(mutex_1);
 
         // Esperar para dejar que la otra tarea se ejecute
-        printf("Tarea A se va a dormir\n");
+        LOG(DLOG_B_DUERME);
         vTaskDelay(500 / portTICK_PERIOD_MS);
     #endif
   }
 }
 
+#ifdef DLOG_EN
+// Volcado del registro diferido (prioridad baja, sigue corriendo aunque A y B queden en deadlock)
+void doFlush(void *parameters) {
+  while (1) {
+    dlog_flush();
+    vTaskDelay(100 / portTICK_PERIOD_MS);
+  }
+}
+#endif
+
 //*****************************************************************************
 // Main (se ejecuta como su propia tarea con prioridad 1 en el núcleo 1)
 
 void app_main() {
+#ifdef STACK_PROF_EN
+    // Informe de pila de todas las tareas, también las del sistema (IDLE, Tmr Svc, esp_timer)
+    stack_prof_start(STACK_PROF_DEFAULT_PERIOD_MS, STACK_PROF_DEFAULT_MARGIN, 1, tskNO_AFFINITY);
+#endif
+
     // Configurar Serial
 
     // Esperar un momento para comenzar (para no perder la salida Serial)
     vTaskDelay(1000 / portTICK_PERIOD_MS);
     printf("\n---Demostración de Deadlock en FreeRTOS---\n");
 
+#ifdef DLOG_BENCH_EN
+    dlog_benchmark();
+#endif
+
     // Crear mutexes antes de iniciar las tareas
     mutex_1 = xSemaphoreCreateMutex();
     mutex_2 = xSemaphoreCreateMutex();
 
+#ifdef LOG_MUX_EN
+    // Drenado hacia la consola en el núcleo 0: sigue corriendo aunque A y B queden en deadlock
+    log_mux_init(&log_mux);
+    uart_tx_backend_stdout(&log_be);
+    uart_tx_stage_init(&log_stage, &log_be, UART_TX_STAGE_LEN, portMAX_DELAY);
+    log_mux_start(&log_mux, &log_stage, LOG_MUX_DEFAULT_DRAIN_MS, 1, 0);
+#endif
+
+#ifdef LOCK_PROF_EN
+    // Registrar los bloqueos y arrancar el monitor en el núcleo 0
+    lock_prof_register(mutex_1, "mutex_1");
+    lock_prof_register(mutex_2, "mutex_2");
+    lock_prof_start(LOCK_PROF_DUMP_MS, 1, 0);
+#endif
+
     // Iniciar Tarea A (alta prioridad)
     xTaskCreatePinnedToCore(doTaskA,
                             "Tarea A",
@@ -240,6 +331,17 @@ void app_main() {
                             app_cpu);
 
 
+#ifdef DLOG_EN
+    // Volcado del registro diferido
+    xTaskCreatePinnedToCore(doFlush,
+                            "Volcado",
+                            2048,
+                            NULL,
+                            1,
+                            NULL,
+                            app_cpu);
+#endif
+
     // Eliminar tarea "setup and loop"
     vTaskDelete(NULL);
     while(1){
@@ -0,0 +1,175 @@
+/**
+ *
+ * Resumen:
+ * Herramienta de host que convierte el flujo binario del registro diferido
+ * (dlog) del Ejemplo9 en texto. Usa la misma tabla include/dlog_fmt.def que
+ * se compiló en el dispositivo, por lo que hay que decodificar con la tabla
+ * de la misma versión del firmware.
+ *
+ * Compilar:  gcc -O2 -I../include -o dlog_decode dlog_decode.c
+ * Uso:       dlog_decode captura.bin
+ *            cat /dev/ttyUSB0 | dlog_decode
+ *            dlog_decode -r captura.bin    (captura sin conversión LF -> CRLF)
+ *
+ * La consola de ESP-IDF convierte cada 0x0A en 0x0D 0x0A; por defecto se
+ * deshace esa conversión. El texto de consola mezclado con los registros se
+ * descarta buscando el byte de sincronismo. Cada registro se verifica con su
+ * CRC-8 antes de imprimirlo; si falla (un 0xA5 dentro de un argumento o del
+ * texto) sus bytes vuelven al flujo y la búsqueda sigue desde el siguiente.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "dlog.h"
+
+// Tablas generadas a partir de dlog_fmt.def (las mismas que en el dispositivo)
+static const char *const fmt_table[DLOG_COUNT] = {
+#define DLOG_FMT(name, nargs, fmt)  fmt,
+#include "dlog_fmt.def"
+#undef DLOG_FMT
+};
+
+static const uint8_t nargs_table[DLOG_COUNT] = {
+#define DLOG_FMT(name, nargs, fmt)  nargs,
+#include "dlog_fmt.def"
+#undef DLOG_FMT
+};
+
+static FILE *in;
+static int undo_crlf = 1;
+
+// Bytes devueltos al flujo por un registro que no pasó la verificación
+static uint8_t back[2 * DLOG_MAX_REC];
+static size_t back_pos, back_len;
+
+// Bytes del registro en curso, después del sincronismo
+static uint8_t rec[DLOG_MAX_REC];
+static size_t rec_len;
+
+// Leer un byte deshaciendo la conversión LF -> CRLF de la consola
+static int next_byte(void)
+{
+  if (back_pos < back_len) {
+    return back[back_pos++];
+  }
+
+  int c = fgetc(in);
+
+  if (undo_crlf && c == '\r') {
+    int d = fgetc(in);
+    if (d == '\n') {
+      return d;
+    }
+    if (d != EOF) {
+      ungetc(d, in);
+    }
+  }
+  return c;
+}
+
+// Leer un byte del registro en curso y guardarlo para el CRC
+static int rec_byte(void)
+{
+  int c = next_byte();
+
+  if (c != EOF && rec_len < sizeof(rec)) {
+    rec[rec_len++] = (uint8_t)c;
+  }
+  return c;
+}
+
+// Devolver el registro en curso al flujo, delante de lo que quedaba pendiente
+static void unread_rec(void)
+{
+  size_t rest = back_len - back_pos;
+
+  memmove(back + rec_len, back + back_pos, rest);
+  memcpy(back, rec, rec_len);
+  back_pos = 0;
+  back_len = rec_len + rest;
+}
+
+// Leer un argumento LEB128; -1 si el flujo termina o el valor es inválido
+static int next_varint(uint32_t *v)
+{
+  *v = 0;
+  for (int shift = 0; shift < 35; shift += 7) {
+    int c = rec_byte();
+    if (c == EOF) {
+      return -1;
+    }
+    *v |= (uint32_t)(c & 0x7F) << shift;
+    if ((c & 0x80) == 0) {
+      return 0;
+    }
+  }
+  return -1;
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned long records = 0, bad = 0;
+  uint32_t now_ms = 0;
+  int c;
+
+  in = stdin;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-r") == 0) {
+      undo_crlf = 0;
+    } else {
+      in = fopen(argv[i], "rb");
+      if (in == NULL) {
+        perror(argv[i]);
+        return 1;
+      }
+    }
+  }
+
+  while ((c = next_byte()) != EOF) {
+    if (c != DLOG_SYNC) {
+      continue;
+    }
+
+    // Encabezado: identificador y ms desde el registro anterior
+    uint32_t delta;
+    rec_len = 0;
+    int id = rec_byte();
+    if (id == EOF) {
+      break;
+    }
+    int ok = (id < DLOG_COUNT && next_varint(&delta) == 0 && delta <= UINT16_MAX);
+
+    uint32_t args[DLOG_MAX_ARGS] = {0};
+    for (int i = 0; ok && i < nargs_table[id]; i++) {
+      ok = (next_varint(&args[i]) == 0);
+    }
+
+    // El CRC cubre todo lo leído desde el identificador
+    if (ok) {
+      uint8_t crc = dlog_crc8(rec, rec_len);
+      ok = (rec_byte() == crc);
+    }
+    if (!ok) {
+      // Sincronismo falso o registro dañado: seguir después de este 0xA5
+      bad++;
+      unread_rec();
+      continue;
+    }
+
+    now_ms += delta;
+    printf("[%8lu ms] ", (unsigned long)now_ms);
+    printf(fmt_table[id], args[0], args[1], args[2], args[3]);
+    records++;
+  }
+
+  fprintf(stderr, "registros: %lu | inválidos: %lu\n", records, bad);
+
+  if (in != stdin) {
+    fclose(in);
+  }
+  return 0;
+}
@@ -0,0 +1,64 @@
+/**
+ *
+ * Resumen:
+ * Reloj compartido por las mediciones y las marcas de tiempo de los ejemplos.
+ *
+ * - bench_now_us(): microsegundos monotónicos de 64 bits (esp_timer en el ESP32).
+ * - bench_ticks(): contador de 32 bits de alta resolución para medir tramos
+ *   cortos. En el ESP32 es el contador de ciclos de la CPU y cada núcleo tiene
+ *   el suyo: el inicio y el fin deben tomarse en el mismo núcleo.
+ *   BENCH_TICK_UNIT y BENCH_TICKS_PER_US describen la unidad.
+ * - En el host (sin ESP_PLATFORM o con el target linux de ESP-IDF, igual que
+ *   hr_sched) ambos salen de clock_gettime(CLOCK_MONOTONIC) y el tick es 1 ns.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef BENCH_CLOCK_H
+#define BENCH_CLOCK_H
+
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#include "esp_cpu.h"
+#include "esp_timer.h"
+
+#define BENCH_TICK_UNIT     "ciclos"
+#define BENCH_TICKS_PER_US  (CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ)
+
+static inline uint64_t bench_now_us(void)
+{
+  return (uint64_t)esp_timer_get_time();
+}
+
+static inline uint32_t bench_ticks(void)
+{
+  return (uint32_t)esp_cpu_get_cycle_count();
+}
+#else
+#include <time.h>
+
+#define BENCH_TICK_UNIT     "ns"
+#define BENCH_TICKS_PER_US  (1000)
+
+static inline uint64_t bench_now_us(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000u;
+}
+
+static inline uint32_t bench_ticks(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec);
+}
+#endif
+
+#endif // BENCH_CLOCK_H
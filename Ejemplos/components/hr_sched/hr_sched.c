@@ -0,0 +1,255 @@
+/**
+ *
+ * Resumen:
+ * Implementación de la planificación de alta resolución (ver hr_sched.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include "hr_sched.h"
+
+//*****************************************************************************
+// Exclusión de la lista
+
+#ifdef HR_SCHED_ESP_TIMER
+static inline void hr_lock(hr_sched_t *sched)
+{
+  portENTER_CRITICAL(&sched->mux);
+}
+
+static inline void hr_unlock(hr_sched_t *sched)
+{
+  portEXIT_CRITICAL(&sched->mux);
+}
+#else
+// En el host el despacho corre en una tarea: alcanza con un mutex
+static inline void hr_lock(hr_sched_t *sched)
+{
+  xSemaphoreTake(sched->lock, portMAX_DELAY);
+}
+
+static inline void hr_unlock(hr_sched_t *sched)
+{
+  xSemaphoreGive(sched->lock);
+}
+#endif
+
+//*****************************************************************************
+// Lista ordenada (con la lista tomada)
+
+static void hr_insert(hr_sched_t *sched, hr_event_t *event)
+{
+  hr_event_t **pp = &sched->head;
+
+  // Detrás de los que vencen en el mismo instante: orden de llegada
+  while (*pp != NULL && (*pp)->deadline <= event->deadline) {
+    pp = &(*pp)->next;
+  }
+  event->next = *pp;
+  *pp = event;
+  event->armed = true;
+}
+
+static void hr_remove(hr_sched_t *sched, hr_event_t *event)
+{
+  hr_event_t **pp = &sched->head;
+
+  while (*pp != NULL && *pp != event) {
+    pp = &(*pp)->next;
+  }
+  if (*pp == event) {
+    *pp = event->next;
+  }
+  event->next = NULL;
+  event->armed = false;
+}
+
+//*****************************************************************************
+// Fuente de tiempo
+
+#ifdef HR_SCHED_ESP_TIMER
+
+// Programar el esp_timer para el primer evento
+static void hr_arm_locked(hr_sched_t *sched)
+{
+  esp_timer_stop(sched->timer);
+  if (sched->head != NULL) {
+    int64_t delta = sched->head->deadline - hr_now_us();
+    esp_timer_start_once(sched->timer, delta > 0 ? (uint64_t)delta : 0);
+  }
+}
+
+// Avisar a la fuente de tiempo con la lista liberada (no hace falta)
+static void hr_kick(hr_sched_t *sched)
+{
+}
+
+#else
+
+static void hr_arm_locked(hr_sched_t *sched)
+{
+}
+
+static void hr_kick(hr_sched_t *sched)
+{
+  xTaskNotifyGive(sched->task);
+}
+
+#endif
+
+//*****************************************************************************
+// Despacho
+
+static void hr_dispatch(void *arg)
+{
+  hr_sched_t *sched = (hr_sched_t *)arg;
+
+  hr_lock(sched);
+  int64_t now = hr_now_us();
+
+  while (sched->head != NULL && sched->head->deadline <= now) {
+    hr_event_t *event = sched->head;
+
+    sched->head = event->next;
+    event->next = NULL;
+    if (now - event->deadline > sched->max_late_us) {
+      sched->max_late_us = now - event->deadline;
+    }
+    sched->fired++;
+
+    TaskHandle_t task = event->task;
+    hr_callback_t cb = event->cb;
+    void *cb_arg = event->arg;
+
+    if (event->period_us != 0) {
+      event->deadline += event->period_us;  // Sin deriva
+      hr_insert(sched, event);
+    } else {
+      event->armed = false;                 // Después de esto puede dejar de existir
+    }
+
+    hr_unlock(sched);
+    if (task != NULL) {
+      xTaskNotifyGive(task);
+    } else {
+      cb(event, cb_arg);
+    }
+    hr_lock(sched);
+
+    now = hr_now_us();
+  }
+
+  hr_arm_locked(sched);
+  hr_unlock(sched);
+}
+
+#ifndef HR_SCHED_ESP_TIMER
+// Host: dormir por ticks lo más posible y el resto con nanosleep
+static void hrService(void *parameters)
+{
+  hr_sched_t *sched = (hr_sched_t *)parameters;
+  const int64_t tick_us = 1000000 / configTICK_RATE_HZ;
+
+  while (1) {
+    hr_lock(sched);
+    bool empty = (sched->head == NULL);
+    int64_t wait = empty ? 0 : sched->head->deadline - hr_now_us();
+    hr_unlock(sched);
+
+    if (empty) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+    if (wait >= 2 * tick_us) {
+      // Se vuelve a mirar al despertar: puede haber llegado uno anterior
+      ulTaskNotifyTake(pdTRUE, (TickType_t)(wait / tick_us - 1));
+      continue;
+    }
+    if (wait > 0) {
+      struct timespec ts = { wait / 1000000, (wait % 1000000) * 1000 };
+      nanosleep(&ts, NULL);
+    }
+    hr_dispatch(sched);
+  }
+}
+#endif
+
+//*****************************************************************************
+// API
+
+bool hr_sched_init(hr_sched_t *sched)
+{
+  sched->head = NULL;
+  sched->fired = 0;
+  sched->max_late_us = 0;
+
+#ifdef HR_SCHED_ESP_TIMER
+  portMUX_INITIALIZE(&sched->mux);
+  esp_timer_create_args_t args = {
+    .callback = hr_dispatch,
+    .arg = sched,
+    .dispatch_method = ESP_TIMER_TASK,
+    .name = "hr_sched",
+  };
+  return esp_timer_create(&args, &sched->timer) == ESP_OK;
+#else
+  sched->lock = xSemaphoreCreateMutexStatic(&sched->lock_buf);
+  return xTaskCreate(hrService, "HR", 2048, sched, configMAX_PRIORITIES - 1, &sched->task) == pdPASS;
+#endif
+}
+
+void hr_start_at(hr_sched_t *sched, hr_event_t *event, int64_t deadline_us, uint32_t period_us)
+{
+  hr_lock(sched);
+  if (event->armed) {
+    hr_remove(sched, event);
+  }
+  event->deadline = deadline_us;
+  event->period_us = period_us;
+  hr_insert(sched, event);
+
+  // Solo si pasó a ser el primero hay que reprogramar
+  bool first = (sched->head == event);
+  if (first) {
+    hr_arm_locked(sched);
+  }
+  hr_unlock(sched);
+
+  if (first) {
+    hr_kick(sched);
+  }
+}
+
+bool hr_cancel(hr_sched_t *sched, hr_event_t *event)
+{
+  bool armed;
+
+  hr_lock(sched);
+  armed = event->armed;
+  if (armed) {
+    // El esp_timer puede quedar programado para este: el despacho no encuentra nada
+    hr_remove(sched, event);
+  }
+  hr_unlock(sched);
+
+  return armed;
+}
+
+void hr_sleep_until(hr_sched_t *sched, int64_t *wake_us, uint32_t period_us)
+{
+  hr_event_t event;
+
+  *wake_us += period_us;
+  if (*wake_us <= hr_now_us()) {
+    return;
+  }
+
+  hr_event_init_notify(&event, xTaskGetCurrentTaskHandle());
+  hr_start_at(sched, &event, *wake_us, 0);
+
+  // Una notificación vieja solo produce una vuelta más
+  while (event.armed) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+}
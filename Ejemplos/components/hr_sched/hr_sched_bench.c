@@ -0,0 +1,113 @@
+/**
+ *
+ * Resumen:
+ * Medición del período logrado por un lazo que quiere despertar cada
+ * BENCH_PERIODS us con tres formas de esperar:
+ * - vTaskDelay(ms / portTICK_PERIOD_MS), como el lazo de Task1: relativo al
+ *   final de la vuelta anterior y truncado a ticks (menos de un tick es 0).
+ * - vTaskDelayUntil: sin deriva, pero con la resolución del tick.
+ * - hr_sleep_until: sin deriva y con resolución de microsegundos.
+ * Se informa el período medio y la desviación media y máxima de cada
+ * intervalo respecto del pedido.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "hr_sched.h"
+
+// Configuración
+#define BENCH_SAMPLES     (100)     // Intervalos medidos por caso
+#define BENCH_PRIORITY    (5)       // Por encima de las tareas del ejemplo
+
+static const uint32_t BENCH_PERIODS[] = { 10000, 2000, 500 };
+
+typedef enum {
+  WAIT_DELAY,
+  WAIT_DELAY_UNTIL,
+  WAIT_HR,
+} wait_mode_t;
+
+static const char *const mode_names[] = { "vTaskDelay", "vTaskDelayUntil", "hr_sleep_until" };
+
+static hr_sched_t sched;
+static int64_t stamps[BENCH_SAMPLES + 1];
+
+//*****************************************************************************
+// Mediciones
+
+static void run_case(wait_mode_t mode, uint32_t period_us)
+{
+  const TickType_t period_ticks = (period_us / 1000) / portTICK_PERIOD_MS;
+  TickType_t last_tick;
+  int64_t last_us;
+
+  // Arrancar alineado a un tick, igual para los tres
+  vTaskDelay(1);
+  last_tick = xTaskGetTickCount();
+  last_us = hr_now_us();
+
+  for (int i = 0; i <= BENCH_SAMPLES; i++) {
+    switch (mode) {
+    case WAIT_DELAY:
+      vTaskDelay(period_ticks);
+      break;
+    case WAIT_DELAY_UNTIL:
+      // Con período 0 vTaskDelayUntil no espera: mismo resultado que vTaskDelay(0)
+      if (period_ticks > 0) {
+        vTaskDelayUntil(&last_tick, period_ticks);
+      } else {
+        taskYIELD();
+      }
+      break;
+    case WAIT_HR:
+      hr_sleep_until(&sched, &last_us, period_us);
+      break;
+    }
+    stamps[i] = hr_now_us();
+  }
+
+  int64_t dev_sum = 0;
+  int64_t dev_max = 0;
+
+  for (int i = 1; i <= BENCH_SAMPLES; i++) {
+    int64_t dev = llabs(stamps[i] - stamps[i - 1] - (int64_t)period_us);
+    dev_sum += dev;
+    if (dev > dev_max) {
+      dev_max = dev;
+    }
+  }
+
+  printf("%-15s | %6lu us | período medio %9.1f us | desvío medio %8.1f us, máx %7lu us\n",
+         mode_names[mode], (unsigned long)period_us,
+         (double)(stamps[BENCH_SAMPLES] - stamps[0]) / BENCH_SAMPLES,
+         (double)dev_sum / BENCH_SAMPLES, (unsigned long)dev_max);
+}
+
+void hr_benchmark(void)
+{
+  UBaseType_t prio = uxTaskPriorityGet(NULL);
+
+  if (!hr_sched_init(&sched)) {
+    printf("No se pudo iniciar la planificación de alta resolución\n");
+    return;
+  }
+
+  printf("---Medición de períodos (tick de %lu us, %d intervalos)---\n",
+         (unsigned long)(1000000 / configTICK_RATE_HZ), BENCH_SAMPLES);
+
+  vTaskPrioritySet(NULL, BENCH_PRIORITY);
+  for (size_t p = 0; p < sizeof(BENCH_PERIODS) / sizeof(BENCH_PERIODS[0]); p++) {
+    for (int m = WAIT_DELAY; m <= WAIT_HR; m++) {
+      run_case((wait_mode_t)m, BENCH_PERIODS[p]);
+    }
+  }
+  vTaskPrioritySet(NULL, prio);
+
+  printf("hr_sched: %lu despachos, atraso máx %ld us\n",
+         (unsigned long)sched.fired, (long)sched.max_late_us);
+}
@@ -0,0 +1,156 @@
+/**
+ *
+ * Resumen:
+ * Planificación de alta resolución (microsegundos) sobre esp_timer, para
+ * esperas y períodos que no entran en la resolución del tick: con
+ * CONFIG_FREERTOS_HZ=100, vTaskDelay(10 / portTICK_PERIOD_MS) es "un tick"
+ * (entre 0 y 10 ms según cuándo se llame) y cualquier valor menor a 10 ms
+ * se redondea a 0.
+ *
+ * - Eventos de una vez o periódicos (hr_event_t, los declara el usuario)
+ *   ordenados por vencimiento; un solo esp_timer de una vez se arma para el
+ *   primero. Los periódicos se rearman sumando el período, sin deriva.
+ * - Al vencer, el evento notifica a una tarea (notificación índice 0) o
+ *   llama a un callback en la tarea de esp_timer.
+ * - hr_sleep_until es el equivalente de vTaskDelayUntil en microsegundos.
+ * - En el host (sin ESP_PLATFORM o con el target linux de ESP-IDF, igual
+ *   que ipc_bench del Ejemplo11) el reloj es CLOCK_MONOTONIC y una tarea de
+ *   servicio duerme por ticks y termina la espera con nanosleep. La lista
+ *   se protege con un mutex porque portMUX_TYPE solo existe en los ports
+ *   del ESP32.
+ * - Componente compartido por los ejemplos (Ejemplos/components): lo usan
+ *   los Ejemplos 1, 2 y 7.
+ * - Insertar es O(n) en la cantidad de eventos armados: pensado para pocos
+ *   eventos de alta resolución (para miles de tiempos de espera a
+ *   resolución de tick está la rueda del Ejemplo7).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef HR_SCHED_H
+#define HR_SCHED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Fuente de tiempo: esp_timer en el ESP32, reloj monotónico en el host
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#define HR_SCHED_ESP_TIMER
+#endif
+
+#ifdef HR_SCHED_ESP_TIMER
+#include "esp_timer.h"
+
+static inline int64_t hr_now_us(void)
+{
+  return esp_timer_get_time();
+}
+#else
+#include <time.h>
+#include "freertos/semphr.h"
+
+static inline int64_t hr_now_us(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+#endif
+
+struct hr_event;
+
+typedef void (*hr_callback_t)(struct hr_event *event, void *arg);
+
+typedef struct hr_event {
+  struct hr_event *next;
+  int64_t deadline;               // En la escala de hr_now_us
+  uint32_t period_us;             // 0: una sola vez
+  TaskHandle_t task;              // Tarea a notificar, o NULL para usar cb
+  hr_callback_t cb;
+  void *arg;
+  volatile bool armed;
+} hr_event_t;
+
+typedef struct {
+  hr_event_t *head;               // Ordenados por vencimiento
+#ifdef HR_SCHED_ESP_TIMER
+  portMUX_TYPE mux;
+  esp_timer_handle_t timer;
+#else
+  SemaphoreHandle_t lock;
+  StaticSemaphore_t lock_buf;
+  TaskHandle_t task;              // Tarea de servicio del host
+#endif
+  uint32_t fired;
+  int64_t max_late_us;            // Atraso máximo del despacho
+} hr_sched_t;
+
+/**
+ * @brief Crear el esp_timer (o la tarea de servicio en el host)
+ */
+bool hr_sched_init(hr_sched_t *sched);
+
+// Evento que despierta a `task` con una notificación
+static inline void hr_event_init_notify(hr_event_t *event, TaskHandle_t task)
+{
+  event->next = NULL;
+  event->task = task;
+  event->cb = NULL;
+  event->arg = NULL;
+  event->armed = false;
+}
+
+// Evento que llama a `cb` (en la tarea de esp_timer: tiene que ser corto)
+static inline void hr_event_init_cb(hr_event_t *event, hr_callback_t cb, void *arg)
+{
+  event->next = NULL;
+  event->task = NULL;
+  event->cb = cb;
+  event->arg = arg;
+  event->armed = false;
+}
+
+/**
+ * @brief Armar (o rearmar) para vencer en el instante absoluto `deadline_us`
+ *        y después cada `period_us` (0: una sola vez)
+ */
+void hr_start_at(hr_sched_t *sched, hr_event_t *event, int64_t deadline_us, uint32_t period_us);
+
+static inline void hr_start(hr_sched_t *sched, hr_event_t *event, uint32_t delay_us, uint32_t period_us)
+{
+  hr_start_at(sched, event, hr_now_us() + delay_us, period_us);
+}
+
+/**
+ * @return true si estaba armado
+ */
+bool hr_cancel(hr_sched_t *sched, hr_event_t *event);
+
+/**
+ * @brief Dormir hasta *wake_us + period_us y actualizar *wake_us (como
+ *        vTaskDelayUntil); si ya pasó, vuelve enseguida
+ *
+ * Usa la notificación índice 0 de la tarea que llama.
+ */
+void hr_sleep_until(hr_sched_t *sched, int64_t *wake_us, uint32_t period_us);
+
+static inline void hr_sleep_us(hr_sched_t *sched, uint32_t us)
+{
+  int64_t wake = hr_now_us();
+
+  hr_sleep_until(sched, &wake, us);
+}
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar período medio y jitter de vTaskDelay, vTaskDelayUntil y
+ *        hr_sleep_until para períodos de 10 ms, 2 ms y 500 us
+ */
+void hr_benchmark(void);
+
+#endif // HR_SCHED_H
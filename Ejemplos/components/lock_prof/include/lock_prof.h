@@ -0,0 +1,107 @@
+/**
+ *
+ * Resumen:
+ * Perfilador de contención de mutex y semáforos. lock_prof_take y
+ * lock_prof_give envuelven a xSemaphoreTake/xSemaphoreGive y, para cada
+ * bloqueo registrado, cuentan:
+ *
+ * - tomas exitosas, tomas que lo encontraron ocupado y esperas vencidas;
+ * - tiempo de espera total y máximo (solo cuando estaba ocupado);
+ * - una espera por sondeo (TAKE(sem, 0) y vTaskDelay hasta obtenerlo) cuenta
+ *   como una sola toma ocupada, desde el primer intento fallido de la tarea
+ *   hasta su próxima toma exitosa; cada intento fallido suma a vencidas;
+ * - una espera bloqueante (TAKE(sem, ticks > 0)) que vence cuenta su espera
+ *   completa en ese momento y no queda pendiente;
+ * - tiempo de retención total y máximo, y la tarea que lo retuvo más tiempo;
+ * - quién lo tiene ahora y desde hace cuánto (útil con un deadlock).
+ *
+ * lock_prof_dump lista los bloqueos del más caliente (más tiempo de espera
+ * acumulado) al más frío. Para activarlo solo en una compilación de prueba
+ * se usan macros en main.c, como en:
+ *
+ *   #ifdef LOCK_PROF_EN
+ *     #define TAKE(sem, ticks)  lock_prof_take(sem, ticks)
+ *     #define GIVE(sem)         lock_prof_give(sem)
+ *   #else
+ *     #define TAKE(sem, ticks)  xSemaphoreTake(sem, ticks)
+ *     #define GIVE(sem)         xSemaphoreGive(sem)
+ *   #endif
+ *
+ * Los bloqueos se registran antes de iniciar las tareas que los usan; un
+ * handle no registrado pasa directo a FreeRTOS. lock_prof_start crea una
+ * tarea que imprime el reporte al recibir LOCK_PROF_DUMP_KEY por la consola
+ * o cada `period_ms`.
+ *
+ * Usado por los Ejemplos 5, 9 y 10.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef LOCK_PROF_H
+#define LOCK_PROF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#define LOCK_PROF_MAX_LOCKS   (8)
+#define LOCK_PROF_MAX_WAITERS (4)     // Tareas esperando por sondeo en cada bloqueo
+#define LOCK_PROF_DEFAULT_PERIOD_MS (10000)
+#define LOCK_PROF_DUMP_KEY    ('l')   // Tecla de la consola que pide el reporte
+
+// Tarea que falló un intento y todavía no lo obtuvo
+typedef struct {
+  TaskHandle_t task;              // NULL si la ranura está libre
+  int64_t since_us;               // Primer intento fallido
+} lock_prof_waiter_t;
+
+typedef struct {
+  SemaphoreHandle_t sem;
+  const char *name;
+  uint32_t acquisitions;          // Tomas exitosas
+  uint32_t contended;             // Tomas que lo encontraron ocupado
+  uint32_t timeouts;              // Tomas que vencieron sin obtenerlo
+  uint64_t wait_total_us;
+  uint32_t wait_max_us;
+  uint64_t hold_total_us;
+  uint32_t hold_max_us;
+  char hold_max_task[configMAX_TASK_NAME_LEN];  // Tarea de la retención máxima
+  TaskHandle_t holder;            // NULL si está libre
+  int64_t held_since_us;
+  lock_prof_waiter_t waiters[LOCK_PROF_MAX_WAITERS];
+} lock_prof_entry_t;
+
+/**
+ * @brief Registrar un mutex o semáforo con un nombre para el reporte
+ */
+bool lock_prof_register(SemaphoreHandle_t sem, const char *name);
+
+/**
+ * @brief xSemaphoreTake con medición
+ */
+BaseType_t lock_prof_take(SemaphoreHandle_t sem, TickType_t ticks);
+
+/**
+ * @brief xSemaphoreGive con medición
+ */
+BaseType_t lock_prof_give(SemaphoreHandle_t sem);
+
+/**
+ * @brief Imprimir los bloqueos ordenados del más caliente al más frío
+ */
+void lock_prof_dump(void);
+
+/**
+ * @brief Poner a cero los contadores (se conserva quién lo tiene ahora)
+ */
+void lock_prof_reset(void);
+
+/**
+ * @brief Crear una tarea que imprime el reporte con LOCK_PROF_DUMP_KEY o cada `period_ms`
+ */
+bool lock_prof_start(uint32_t period_ms, UBaseType_t priority, BaseType_t core);
+
+#endif // LOCK_PROF_H
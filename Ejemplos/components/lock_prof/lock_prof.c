@@ -0,0 +1,234 @@
+/**
+ *
+ * Resumen:
+ * Implementación del perfilador de contención y de su tarea de reporte
+ * (ver lock_prof.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "lock_prof.h"
+
+static lock_prof_entry_t entries[LOCK_PROF_MAX_LOCKS];
+static uint32_t num_entries;
+static portMUX_TYPE prof_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t dump_period_ms;
+
+bool lock_prof_register(SemaphoreHandle_t sem, const char *name)
+{
+  bool ok = false;
+
+  portENTER_CRITICAL(&prof_lock);
+  if (num_entries < LOCK_PROF_MAX_LOCKS) {
+    lock_prof_entry_t *e = &entries[num_entries++];
+    memset(e, 0, sizeof(*e));
+    e->sem = sem;
+    e->name = name;
+    ok = true;
+  }
+  portEXIT_CRITICAL(&prof_lock);
+
+  return ok;
+}
+
+// La tabla no cambia después de iniciar las tareas: se busca sin bloquear
+static lock_prof_entry_t *find_entry(SemaphoreHandle_t sem)
+{
+  for (uint32_t i = 0; i < num_entries; i++) {
+    if (entries[i].sem == sem) {
+      return &entries[i];
+    }
+  }
+  return NULL;
+}
+
+// Espera pendiente de `task` (con prof_lock tomado)
+static lock_prof_waiter_t *find_waiter(lock_prof_entry_t *e, TaskHandle_t task)
+{
+  for (uint32_t i = 0; i < LOCK_PROF_MAX_WAITERS; i++) {
+    if (e->waiters[i].task == task) {
+      return &e->waiters[i];
+    }
+  }
+  return NULL;
+}
+
+static void add_wait(lock_prof_entry_t *e, uint32_t wait_us)
+{
+  e->contended++;
+  e->wait_total_us += wait_us;
+  if (wait_us > e->wait_max_us) {
+    e->wait_max_us = wait_us;
+  }
+}
+
+BaseType_t lock_prof_take(SemaphoreHandle_t sem, TickType_t ticks)
+{
+  lock_prof_entry_t *e = find_entry(sem);
+
+  if (e == NULL) {
+    return xSemaphoreTake(sem, ticks);
+  }
+
+  // Primero sin esperar, para distinguir si estaba ocupado
+  int64_t t0 = esp_timer_get_time();
+  BaseType_t res = xSemaphoreTake(sem, 0);
+  bool busy = (res != pdTRUE);
+
+  if (busy && ticks > 0) {
+    res = xSemaphoreTake(sem, ticks);
+  }
+  int64_t now = esp_timer_get_time();
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+
+  portENTER_CRITICAL(&prof_lock);
+  // Un intento fallido anterior: la espera empezó ahí, no en esta llamada
+  lock_prof_waiter_t *w = find_waiter(e, self);
+
+  if (res == pdTRUE) {
+    if (w != NULL) {
+      add_wait(e, (uint32_t)(now - w->since_us));
+      w->task = NULL;
+    } else if (busy) {
+      add_wait(e, (uint32_t)(now - t0));
+    }
+    e->acquisitions++;
+    e->holder = self;
+    e->held_since_us = now;
+  } else {
+    e->timeouts++;
+    if (ticks > 0) {
+      // Espera bloqueante vencida: la espera termina acá y no queda pendiente
+      add_wait(e, (uint32_t)(now - (w != NULL ? w->since_us : t0)));
+      if (w != NULL) {
+        w->task = NULL;
+      }
+    } else if (w == NULL && (w = find_waiter(e, NULL)) != NULL) {
+      w->task = self;
+      w->since_us = t0;
+    } else if (w == NULL) {
+      // Sin lugar para seguirla: se cuenta solo lo que esperó esta llamada
+      add_wait(e, (uint32_t)(now - t0));
+    }
+  }
+  portEXIT_CRITICAL(&prof_lock);
+
+  return res;
+}
+
+BaseType_t lock_prof_give(SemaphoreHandle_t sem)
+{
+  lock_prof_entry_t *e = find_entry(sem);
+
+  if (e == NULL) {
+    return xSemaphoreGive(sem);
+  }
+
+  // Cerrar la retención antes de devolverlo (después lo puede tomar otra tarea);
+  // devolver un mutex ajeno falla y no cuenta
+  int64_t now = esp_timer_get_time();
+
+  portENTER_CRITICAL(&prof_lock);
+  if (e->holder == xTaskGetCurrentTaskHandle()) {
+    uint32_t hold_us = (uint32_t)(now - e->held_since_us);
+
+    e->hold_total_us += hold_us;
+    if (hold_us > e->hold_max_us) {
+      e->hold_max_us = hold_us;
+      strncpy(e->hold_max_task, pcTaskGetName(e->holder), sizeof(e->hold_max_task) - 1);
+    }
+    e->holder = NULL;
+  }
+  portEXIT_CRITICAL(&prof_lock);
+
+  return xSemaphoreGive(sem);
+}
+
+void lock_prof_dump(void)
+{
+  lock_prof_entry_t snap[LOCK_PROF_MAX_LOCKS];
+  uint32_t count;
+  int64_t now = esp_timer_get_time();
+
+  portENTER_CRITICAL(&prof_lock);
+  count = num_entries;
+  memcpy(snap, entries, count * sizeof(snap[0]));
+  portEXIT_CRITICAL(&prof_lock);
+
+  // Ordenar por espera acumulada y después por veces ocupado (inserción, pocos elementos)
+  for (uint32_t i = 1; i < count; i++) {
+    lock_prof_entry_t tmp = snap[i];
+    uint32_t j = i;
+
+    while (j > 0 && (snap[j - 1].wait_total_us < tmp.wait_total_us ||
+                     (snap[j - 1].wait_total_us == tmp.wait_total_us &&
+                      snap[j - 1].contended < tmp.contended))) {
+      snap[j] = snap[j - 1];
+      j--;
+    }
+    snap[j] = tmp;
+  }
+
+  printf("bloqueo      |  tomas | ocupado | vencidas | espera tot/máx ms | retención tot/máx ms | retuvo más   | ahora\n");
+  for (uint32_t i = 0; i < count; i++) {
+    const lock_prof_entry_t *e = &snap[i];
+
+    printf("%-12s | %6lu | %7lu | %8lu | %8lu / %6lu | %10lu / %7lu | %-12s | ",
+           e->name, (unsigned long)e->acquisitions, (unsigned long)e->contended,
+           (unsigned long)e->timeouts,
+           (unsigned long)(e->wait_total_us / 1000), (unsigned long)(e->wait_max_us / 1000),
+           (unsigned long)(e->hold_total_us / 1000), (unsigned long)(e->hold_max_us / 1000),
+           e->hold_max_task[0] ? e->hold_max_task : "-");
+    if (e->holder != NULL) {
+      printf("%s hace %lu ms\n", pcTaskGetName(e->holder),
+             (unsigned long)((now - e->held_since_us) / 1000));
+    } else {
+      printf("libre\n");
+    }
+  }
+}
+
+void lock_prof_reset(void)
+{
+  // Las esperas pendientes se conservan: terminan en la próxima toma
+  portENTER_CRITICAL(&prof_lock);
+  for (uint32_t i = 0; i < num_entries; i++) {
+    lock_prof_entry_t *e = &entries[i];
+
+    e->acquisitions = 0;
+    e->contended = 0;
+    e->timeouts = 0;
+    e->wait_total_us = 0;
+    e->wait_max_us = 0;
+    e->hold_total_us = 0;
+    e->hold_max_us = 0;
+    e->hold_max_task[0] = '\0';
+  }
+  portEXIT_CRITICAL(&prof_lock);
+}
+
+// Imprimir el reporte al recibir LOCK_PROF_DUMP_KEY por la consola o cada dump_period_ms
+static void lockProfTask(void *parameters)
+{
+  TickType_t last = xTaskGetTickCount();
+
+  while (1) {
+    if (getchar() == LOCK_PROF_DUMP_KEY ||
+        xTaskGetTickCount() - last >= pdMS_TO_TICKS(dump_period_ms)) {
+      lock_prof_dump();
+      last = xTaskGetTickCount();
+    }
+    vTaskDelay(pdMS_TO_TICKS(100));
+  }
+}
+
+bool lock_prof_start(uint32_t period_ms, UBaseType_t priority, BaseType_t core)
+{
+  dump_period_ms = period_ms;
+
+  return xTaskCreatePinnedToCore(lockProfTask, "Lock prof", 3072, NULL, priority, NULL, core) == pdPASS;
+}
@@ -0,0 +1,123 @@
+/**
+ *
+ * Resumen:
+ * Multiplexor de registros (logs) lock-free de varios productores y un
+ * consumidor. Cada tarea reserva un registro completo, lo llena y lo confirma;
+ * una única tarea de drenado de baja prioridad emite los registros enteros y
+ * en orden, así los mensajes de distintas tareas ya no se mezclan.
+ *
+ * - Los productores nunca se bloquean: si no hay lugar el registro se descarta
+ *   y se cuenta en `dropped`.
+ * - Cada registro lleva el identificador de la tarea, el núcleo y una marca de
+ *   tiempo en us.
+ * - Anillo de ranuras con número de secuencia (cola acotada de Vyukov): la
+ *   reserva es un compare-and-swap y la confirmación un store con release.
+ * - log_mux_start crea la tarea de drenado. Una tarea puede registrarse a sí
+ *   misma con su nombre de FreeRTOS (pcTaskGetName(NULL)) al comenzar.
+ *
+ * Usado por los Ejemplos 2, 5, 9 y 10 (con LOG_MUX_EN en su main.c).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef LOG_MUX_H
+#define LOG_MUX_H
+
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "uart_tx.h"
+
+#define LOG_MUX_SLOTS       (64)    // Registros en el anillo (potencia de 2)
+#define LOG_MUX_TEXT_LEN    (96)    // Texto máximo por registro
+#define LOG_MUX_MAX_SRC     (8)     // Tareas registradas
+#define LOG_MUX_DEFAULT_DRAIN_MS (50)
+
+// Registro
+typedef struct {
+  _Atomic uint32_t seq;             // Secuencia de la ranura (protocolo del anillo)
+  uint32_t t_us;                    // Marca de tiempo
+  uint8_t src;                      // Identificador de la tarea
+  uint8_t core;                     // Núcleo donde se generó
+  uint16_t len;                     // Bytes válidos en text
+  char text[LOG_MUX_TEXT_LEN];
+} log_rec_t;
+
+typedef struct {
+  log_rec_t slots[LOG_MUX_SLOTS];
+  _Atomic uint32_t enqueue_pos;         // Próxima ranura a reservar (productores)
+  uint32_t dequeue_pos;                 // Próxima ranura a emitir (solo drenado)
+  _Atomic uint32_t dropped;             // Registros descartados por anillo lleno
+  uint32_t emitted;                     // Registros emitidos
+  const char *names[LOG_MUX_MAX_SRC];
+  _Atomic uint32_t num_src;
+  uart_tx_stage_t *out;                 // Destino de la tarea de drenado
+  uint32_t drain_period_ms;
+} log_mux_t;
+
+void log_mux_init(log_mux_t *mux);
+
+/**
+ * @brief Registrar una tarea productora (una vez, al iniciar)
+ *
+ * @return Identificador a usar en cada registro
+ */
+uint8_t log_mux_register(log_mux_t *mux, const char *name);
+
+/**
+ * @brief Registrar la tarea que llama con su nombre de FreeRTOS
+ */
+uint8_t log_mux_register_self(log_mux_t *mux);
+
+/**
+ * @brief Reservar un registro completo (nunca bloquea)
+ *
+ * @return Registro a llenar o NULL si el anillo está lleno
+ */
+log_rec_t *log_mux_reserve(log_mux_t *mux, uint8_t src);
+
+/**
+ * @brief Publicar un registro reservado para el drenado
+ */
+void log_mux_commit(log_mux_t *mux, log_rec_t *rec);
+
+/**
+ * @brief Reservar, copiar el texto (truncado a LOG_MUX_TEXT_LEN) y confirmar
+ *
+ * @return false si el registro se descartó
+ */
+bool log_mux_write(log_mux_t *mux, uint8_t src, const char *text, size_t len);
+bool log_mux_printf(log_mux_t *mux, uint8_t src, const char *fmt, ...);
+
+/**
+ * @brief Emitir en orden todos los registros confirmados (solo la tarea de drenado)
+ *
+ * Cada registro sale como "[t_us][nombre/núcleo] texto" a través de `out`.
+ * Un salto de línea al final del texto no se duplica, así los formatos de
+ * printf se pueden usar tal cual.
+ *
+ * @return Cantidad de registros emitidos
+ */
+size_t log_mux_drain(log_mux_t *mux, uart_tx_stage_t *out);
+
+/**
+ * @brief Crear la tarea de drenado, que vacía el anillo hacia `out` cada `period_ms`
+ *
+ * Conviene la prioridad más baja: los productores nunca la esperan.
+ */
+bool log_mux_start(log_mux_t *mux, uart_tx_stage_t *out, uint32_t period_ms,
+                   UBaseType_t priority, BaseType_t core);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Medir el costo del productor con varias tareas en ambos núcleos
+ */
+void log_mux_benchmark(void);
+
+#endif // LOG_MUX_H
@@ -0,0 +1,147 @@
+/**
+ *
+ * Resumen:
+ * Capa de transmisión por UART con buffers de preparación por tarea.
+ * Cada tarea escribe en su propio buffer (sin bloqueos) y los bytes se
+ * entregan al driver en lotes cuando se alcanza un tamaño o un plazo,
+ * en lugar de pagar una llamada a uart_write_bytes por byte.
+ *
+ * - uart_tx_write_static() envía cadenas constantes sin copiarlas al buffer.
+ * - El plazo se cumple aunque la tarea deje de escribir: una tarea de envío
+ *   por plazo (uart_tx_flusher_t) duerme hasta el vencimiento más próximo de
+ *   los buffers registrados. Cada buffer tiene un mutex que solo se disputa
+ *   con esa tarea.
+ * - El destino (backend) es intercambiable: UART real, stdout (la consola,
+ *   sin configurar la UART), descriptor de archivo (pipe en host) o nulo
+ *   (solo cuenta bytes, para medir el costo de la capa).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef UART_TX_H
+#define UART_TX_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#define UART_TX_STAGE_LEN   (64)    // Tamaño del buffer de preparación de cada tarea
+#define UART_TX_FLUSHER_MAX (8)     // Buffers por tarea de envío por plazo
+
+// Destino de los bytes
+typedef struct {
+  const char *name;
+  int (*write)(void *ctx, const void *data, size_t len);
+  void (*wait_done)(void *ctx);   // Esperar que salga lo entregado (puede ser NULL)
+  void *ctx;
+} uart_tx_backend_t;
+
+struct uart_tx_flusher;
+
+// Buffer de preparación (uno por tarea; solo lo comparte con la tarea de envío)
+typedef struct {
+  const uart_tx_backend_t *be;
+  size_t flush_len;           // Enviar al llegar a esta cantidad de bytes
+  TickType_t max_delay;       // Enviar si el primer byte pendiente tiene esta antigüedad
+  TickType_t first_tick;      // Tick del primer byte pendiente
+  size_t len;                 // Bytes pendientes
+  uint32_t bytes;             // Bytes entregados al backend
+  uint32_t calls;             // Llamadas al backend
+  SemaphoreHandle_t lock;
+  StaticSemaphore_t lock_buf;
+  struct uart_tx_flusher *flusher;
+  char buf[UART_TX_STAGE_LEN];
+} uart_tx_stage_t;
+
+// Tarea de envío por plazo
+typedef struct uart_tx_flusher {
+  uart_tx_stage_t *stages[UART_TX_FLUSHER_MAX];
+  _Atomic size_t num;             // Se publica después de escribir la ranura
+  TaskHandle_t task;
+} uart_tx_flusher_t;
+
+//*****************************************************************************
+// Backends
+
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#include "driver/uart.h"
+void uart_tx_backend_uart(uart_tx_backend_t *be, uart_port_t port);
+#else
+void uart_tx_backend_fd(uart_tx_backend_t *be, int *fd);
+#endif
+
+void uart_tx_backend_stdout(uart_tx_backend_t *be);
+void uart_tx_backend_null(uart_tx_backend_t *be);
+
+//*****************************************************************************
+// Buffer de preparación
+
+/**
+ * @param flush_len Umbral de tamaño (como máximo UART_TX_STAGE_LEN)
+ * @param max_delay Umbral de tiempo en ticks (0 = enviar en cada escritura)
+ */
+void uart_tx_stage_init(uart_tx_stage_t *st, const uart_tx_backend_t *be,
+                        size_t flush_len, TickType_t max_delay);
+
+/**
+ * @brief Copiar bytes al buffer y enviar si se cumple el tamaño o el plazo
+ */
+void uart_tx_write(uart_tx_stage_t *st, const void *data, size_t len);
+
+/**
+ * @brief Enviar una cadena que no cambia (por ejemplo, en flash) sin copiarla
+ *
+ * Primero se envía lo pendiente para mantener el orden de los bytes.
+ */
+void uart_tx_write_static(uart_tx_stage_t *st, const void *data, size_t len);
+
+/**
+ * @brief Enviar lo pendiente si venció el plazo (para llamar en un bucle ocioso)
+ */
+void uart_tx_poll(uart_tx_stage_t *st);
+
+/**
+ * @brief Enviar todo lo pendiente
+ *
+ * Antes de borrar una tarea hay que llamarlo desde ella misma: lo que quede
+ * en su buffer no lo envía nadie más que la tarea de envío por plazo.
+ */
+void uart_tx_flush(uart_tx_stage_t *st);
+
+//*****************************************************************************
+// Envío por plazo
+
+/**
+ * @brief Crear la tarea que envía los buffers cuyo plazo venció
+ *
+ * Conviene una prioridad baja: solo trabaja cuando el dueño dejó de escribir.
+ */
+bool uart_tx_flusher_start(uart_tx_flusher_t *f, UBaseType_t priority, BaseType_t core);
+
+/**
+ * @brief Registrar un buffer (antes de que su tarea empiece a escribir)
+ *
+ * La tarea de envío ya está corriendo: la ranura se escribe antes de publicar
+ * la cantidad. Los registros deben hacerse desde una sola tarea.
+ */
+bool uart_tx_flusher_add(uart_tx_flusher_t *f, uart_tx_stage_t *st);
+
+//*****************************************************************************
+// Medición
+
+/**
+ * @brief Comparar bytes/s, llamadas/byte y us/llamada de un byte por llamada
+ *        contra lotes
+ *
+ * Cada caso entrega a lo sumo BENCH_BYTES bytes y espera a que salgan antes
+ * del siguiente (wait_done): con un backend real se mide el costo de CPU de
+ * uart_write_bytes sin bloquearse por la velocidad de la línea.
+ */
+void uart_tx_benchmark(const uart_tx_backend_t *be);
+
+#endif // UART_TX_H
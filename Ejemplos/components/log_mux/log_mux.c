@@ -0,0 +1,192 @@
+/**
+ *
+ * Resumen:
+ * Implementación del multiplexor de registros lock-free (ver log_mux.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "log_mux.h"
+
+#include "bench_clock.h"
+#define log_now_us()      ((uint32_t)bench_now_us())
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#define log_core_id()     ((uint8_t)xPortGetCoreID())
+#else
+#define log_core_id()     ((uint8_t)0)
+#endif
+
+#define LOG_MUX_MASK      (LOG_MUX_SLOTS - 1)
+
+void log_mux_init(log_mux_t *mux)
+{
+  // Cada ranura comienza con la secuencia de su posición (libre para esa vuelta)
+  for (uint32_t i = 0; i < LOG_MUX_SLOTS; i++) {
+    atomic_init(&mux->slots[i].seq, i);
+  }
+  atomic_init(&mux->enqueue_pos, 0);
+  atomic_init(&mux->dropped, 0);
+  atomic_init(&mux->num_src, 0);
+  mux->dequeue_pos = 0;
+  mux->emitted = 0;
+  memset(mux->names, 0, sizeof(mux->names));
+  mux->out = NULL;
+  mux->drain_period_ms = 0;
+}
+
+uint8_t log_mux_register(log_mux_t *mux, const char *name)
+{
+  uint32_t id = atomic_fetch_add_explicit(&mux->num_src, 1, memory_order_relaxed);
+
+  if (id >= LOG_MUX_MAX_SRC) {
+    return UINT8_MAX;
+  }
+  mux->names[id] = name;
+  return (uint8_t)id;
+}
+
+uint8_t log_mux_register_self(log_mux_t *mux)
+{
+  // El nombre vive en el TCB mientras exista la tarea
+  return log_mux_register(mux, pcTaskGetName(NULL));
+}
+
+log_rec_t *log_mux_reserve(log_mux_t *mux, uint8_t src)
+{
+  uint32_t pos = atomic_load_explicit(&mux->enqueue_pos, memory_order_relaxed);
+
+  while (1) {
+    log_rec_t *rec = &mux->slots[pos & LOG_MUX_MASK];
+    uint32_t seq = atomic_load_explicit(&rec->seq, memory_order_acquire);
+    int32_t dif = (int32_t)(seq - pos);
+
+    if (dif == 0) {
+      // Ranura libre: intentar quedarse con esta posición
+      if (atomic_compare_exchange_weak_explicit(&mux->enqueue_pos, &pos, pos + 1,
+                                                memory_order_relaxed, memory_order_relaxed)) {
+        rec->t_us = log_now_us();
+        rec->src = src;
+        rec->core = log_core_id();
+        rec->len = 0;
+        return rec;
+      }
+      // Otro productor ganó la posición; `pos` ya tiene el valor actual
+    } else if (dif < 0) {
+      // El drenado no liberó todavía esta ranura: anillo lleno
+      atomic_fetch_add_explicit(&mux->dropped, 1, memory_order_relaxed);
+      return NULL;
+    } else {
+      pos = atomic_load_explicit(&mux->enqueue_pos, memory_order_relaxed);
+    }
+  }
+}
+
+void log_mux_commit(log_mux_t *mux, log_rec_t *rec)
+{
+  // La ranura conserva la secuencia de la reserva; +1 la marca como llena
+  uint32_t seq = atomic_load_explicit(&rec->seq, memory_order_relaxed);
+  atomic_store_explicit(&rec->seq, seq + 1, memory_order_release);
+}
+
+bool log_mux_write(log_mux_t *mux, uint8_t src, const char *text, size_t len)
+{
+  log_rec_t *rec = log_mux_reserve(mux, src);
+
+  if (rec == NULL) {
+    return false;
+  }
+  if (len > LOG_MUX_TEXT_LEN) {
+    len = LOG_MUX_TEXT_LEN;
+  }
+  memcpy(rec->text, text, len);
+  rec->len = (uint16_t)len;
+  log_mux_commit(mux, rec);
+
+  return true;
+}
+
+bool log_mux_printf(log_mux_t *mux, uint8_t src, const char *fmt, ...)
+{
+  log_rec_t *rec = log_mux_reserve(mux, src);
+  va_list args;
+
+  if (rec == NULL) {
+    return false;
+  }
+  va_start(args, fmt);
+  int n = vsnprintf(rec->text, LOG_MUX_TEXT_LEN, fmt, args);
+  va_end(args);
+
+  // vsnprintf devuelve el largo sin truncar
+  if (n < 0) {
+    n = 0;
+  } else if (n >= LOG_MUX_TEXT_LEN) {
+    n = LOG_MUX_TEXT_LEN - 1;
+  }
+  rec->len = (uint16_t)n;
+  log_mux_commit(mux, rec);
+
+  return true;
+}
+
+size_t log_mux_drain(log_mux_t *mux, uart_tx_stage_t *out)
+{
+  char header[32];
+  size_t n = 0;
+
+  while (1) {
+    uint32_t pos = mux->dequeue_pos;
+    log_rec_t *rec = &mux->slots[pos & LOG_MUX_MASK];
+
+    // Se respeta el orden de reserva: si el próximo registro no está
+    // confirmado todavía se espera al siguiente drenado
+    if (atomic_load_explicit(&rec->seq, memory_order_acquire) != pos + 1) {
+      break;
+    }
+
+    const char *name = (rec->src < LOG_MUX_MAX_SRC && mux->names[rec->src]) ? mux->names[rec->src] : "?";
+    int hl = snprintf(header, sizeof(header), "[%10lu][%s/%u] ",
+                      (unsigned long)rec->t_us, name, rec->core);
+    uint16_t len = rec->len;
+    if (len > 0 && rec->text[len - 1] == '\n') {
+      len--;
+    }
+    uart_tx_write(out, header, hl < (int)sizeof(header) ? (size_t)hl : sizeof(header) - 1);
+    uart_tx_write(out, rec->text, len);
+    uart_tx_write(out, "\n", 1);
+
+    // Liberar la ranura para la próxima vuelta del anillo
+    atomic_store_explicit(&rec->seq, pos + LOG_MUX_SLOTS, memory_order_release);
+    mux->dequeue_pos = pos + 1;
+    mux->emitted++;
+    n++;
+  }
+
+  uart_tx_flush(out);
+  return n;
+}
+
+// Drenado periódico con la prioridad que eligió log_mux_start
+static void logMuxTask(void *parameters)
+{
+  log_mux_t *mux = (log_mux_t *)parameters;
+
+  while (1) {
+    log_mux_drain(mux, mux->out);
+    vTaskDelay(pdMS_TO_TICKS(mux->drain_period_ms));
+  }
+}
+
+bool log_mux_start(log_mux_t *mux, uart_tx_stage_t *out, uint32_t period_ms,
+                   UBaseType_t priority, BaseType_t core)
+{
+  mux->out = out;
+  mux->drain_period_ms = period_ms;
+
+  return xTaskCreatePinnedToCore(logMuxTask, "Drenado", 2048, mux, priority, NULL, core) == pdPASS;
+}
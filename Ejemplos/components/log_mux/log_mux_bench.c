@@ -0,0 +1,158 @@
+/**
+ *
+ * Resumen:
+ * Medición del costo del lado productor de log_mux con contención: varias
+ * tareas en ambos núcleos escriben registros al mismo tiempo mientras una
+ * tarea de drenado de baja prioridad los emite a un backend nulo.
+ *
+ * Cada productor escribe ráfagas de BENCH_BURST registros por tick: todas
+ * las ráfagas de un tick entran en el anillo y el drenado lo vacía antes
+ * del siguiente, así casi no hay descartes. El costo de los registros
+ * aceptados se informa aparte del de los descartados (que solo leen la
+ * secuencia y cuentan).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "log_mux.h"
+
+#include "bench_clock.h"
+
+// Configuración
+#define BENCH_PRODUCERS   (4)       // Repartidos entre los núcleos
+#define BENCH_RECORDS     (2000)    // Registros por productor
+#define BENCH_BURST       (8)       // Registros por productor y por tick
+
+#if BENCH_PRODUCERS * BENCH_BURST > LOG_MUX_SLOTS
+  #error "Las ráfagas de un tick no entran en el anillo: bajar BENCH_BURST"
+#endif
+
+#if CONFIG_FREERTOS_UNICORE
+  #define BENCH_CORES     (1)
+#else
+  #define BENCH_CORES     (2)
+#endif
+
+// Costo de una clase de escrituras (aceptadas o descartadas)
+typedef struct {
+  uint32_t n;
+  uint32_t max;
+  uint64_t sum;
+} bench_cost_t;
+
+typedef struct {
+  uint8_t src;
+  bench_cost_t ok;
+  bench_cost_t drop;
+} bench_prod_t;
+
+static log_mux_t bench_mux;
+static bench_prod_t prods[BENCH_PRODUCERS];
+static SemaphoreHandle_t done_sem;
+static volatile bool draining;
+
+static const char bench_text[] = "registro de prueba de 32 bytes.";
+
+static void cost_add(bench_cost_t *c, uint32_t dt)
+{
+  c->n++;
+  c->sum += dt;
+  if (dt > c->max) {
+    c->max = dt;
+  }
+}
+
+static void cost_print(const char *label, const bench_cost_t *c)
+{
+  printf(" | %s: %5lu, media %7.1f %s, max %7lu %s", label, (unsigned long)c->n,
+         c->n ? (double)c->sum / c->n : 0.0, BENCH_TICK_UNIT,
+         (unsigned long)c->max, BENCH_TICK_UNIT);
+}
+
+// Productor: el inicio y el fin de cada medición ocurren en el mismo núcleo
+static void benchProducer(void *parameters)
+{
+  bench_prod_t *p = (bench_prod_t *)parameters;
+
+  for (int i = 0; i < BENCH_RECORDS; i++) {
+    uint32_t t0 = bench_ticks();
+    bool ok = log_mux_write(&bench_mux, p->src, bench_text, sizeof(bench_text) - 1);
+    uint32_t dt = bench_ticks() - t0;
+
+    cost_add(ok ? &p->ok : &p->drop, dt);
+
+    // Fin de la ráfaga: el drenado vacía el anillo mientras los productores duermen
+    if (i % BENCH_BURST == BENCH_BURST - 1) {
+      vTaskDelay(1);
+    }
+  }
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+// Drenado de baja prioridad hacia un backend nulo
+static void benchDrain(void *parameters)
+{
+  uart_tx_backend_t null_be;
+  uart_tx_stage_t out;
+
+  uart_tx_backend_null(&null_be);
+  uart_tx_stage_init(&out, &null_be, UART_TX_STAGE_LEN, portMAX_DELAY);
+
+  while (draining) {
+    if (log_mux_drain(&bench_mux, &out) == 0) {
+      vTaskDelay(1);
+    }
+  }
+  log_mux_drain(&bench_mux, &out);
+
+  xSemaphoreGive(done_sem);
+  vTaskDelete(NULL);
+}
+
+void log_mux_benchmark(void)
+{
+  char name[BENCH_PRODUCERS][8];
+
+  log_mux_init(&bench_mux);
+  done_sem = xSemaphoreCreateCounting(BENCH_PRODUCERS + 1, 0);
+  draining = true;
+
+  printf("---Medición log_mux (%d productores, %d registros c/u en ráfagas de %d, anillo de %d)---\n",
+         BENCH_PRODUCERS, BENCH_RECORDS, BENCH_BURST, LOG_MUX_SLOTS);
+
+  xTaskCreatePinnedToCore(benchDrain, "Drenado", 3072, NULL, 1, NULL, 0);
+
+  for (int i = 0; i < BENCH_PRODUCERS; i++) {
+    snprintf(name[i], sizeof(name[i]), "P%d", i);
+    memset(&prods[i], 0, sizeof(prods[i]));
+    prods[i].src = log_mux_register(&bench_mux, name[i]);
+    xTaskCreatePinnedToCore(benchProducer, name[i], 2048, &prods[i], 5, NULL, i % BENCH_CORES);
+  }
+
+  // Esperar a los productores y después al drenado
+  for (int i = 0; i < BENCH_PRODUCERS; i++) {
+    xSemaphoreTake(done_sem, portMAX_DELAY);
+  }
+  draining = false;
+  xSemaphoreTake(done_sem, portMAX_DELAY);
+
+  for (int i = 0; i < BENCH_PRODUCERS; i++) {
+    printf("%s (núcleo %d)", name[i], i % BENCH_CORES);
+    cost_print("aceptados", &prods[i].ok);
+    cost_print("descartados", &prods[i].drop);
+    printf("\n");
+  }
+  printf("emitidos: %lu | descartados: %lu\n",
+         (unsigned long)bench_mux.emitted,
+         (unsigned long)atomic_load(&bench_mux.dropped));
+
+  vSemaphoreDelete(done_sem);
+}
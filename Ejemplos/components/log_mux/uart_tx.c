@@ -0,0 +1,241 @@
+/**
+ *
+ * Resumen:
+ * Implementación de la capa de transmisión por lotes (ver uart_tx.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "uart_tx.h"
+
+//*****************************************************************************
+// Backends
+
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+static int be_uart_write(void *ctx, const void *data, size_t len)
+{
+  return uart_write_bytes((uart_port_t)(intptr_t)ctx, data, len);
+}
+
+static void be_uart_wait_done(void *ctx)
+{
+  uart_wait_tx_done((uart_port_t)(intptr_t)ctx, portMAX_DELAY);
+}
+
+void uart_tx_backend_uart(uart_tx_backend_t *be, uart_port_t port)
+{
+  be->name = "uart";
+  be->write = be_uart_write;
+  be->wait_done = be_uart_wait_done;
+  be->ctx = (void *)(intptr_t)port;
+}
+#else
+#include <unistd.h>
+
+static int be_fd_write(void *ctx, const void *data, size_t len)
+{
+  return (int)write(*(int *)ctx, data, len);
+}
+
+void uart_tx_backend_fd(uart_tx_backend_t *be, int *fd)
+{
+  be->name = "fd";
+  be->write = be_fd_write;
+  be->wait_done = NULL;
+  be->ctx = fd;
+}
+#endif
+
+static int be_stdout_write(void *ctx, const void *data, size_t len)
+{
+  size_t n = fwrite(data, 1, len, stdout);
+
+  fflush(stdout);
+  return (int)n;
+}
+
+void uart_tx_backend_stdout(uart_tx_backend_t *be)
+{
+  be->name = "stdout";
+  be->write = be_stdout_write;
+  be->wait_done = NULL;
+  be->ctx = NULL;
+}
+
+static int be_null_write(void *ctx, const void *data, size_t len)
+{
+  return (int)len;
+}
+
+void uart_tx_backend_null(uart_tx_backend_t *be)
+{
+  be->name = "nulo";
+  be->write = be_null_write;
+  be->wait_done = NULL;
+  be->ctx = NULL;
+}
+
+//*****************************************************************************
+// Buffer de preparación
+
+// Entregar un tramo al backend y contabilizarlo
+static inline void stage_send(uart_tx_stage_t *st, const void *data, size_t len)
+{
+  st->be->write(st->be->ctx, data, len);
+  st->bytes += len;
+  st->calls++;
+}
+
+void uart_tx_stage_init(uart_tx_stage_t *st, const uart_tx_backend_t *be,
+                        size_t flush_len, TickType_t max_delay)
+{
+  if (flush_len == 0 || flush_len > UART_TX_STAGE_LEN) {
+    flush_len = UART_TX_STAGE_LEN;
+  }
+  st->be = be;
+  st->flush_len = flush_len;
+  st->max_delay = max_delay;
+  st->first_tick = 0;
+  st->len = 0;
+  st->bytes = 0;
+  st->calls = 0;
+  st->lock = xSemaphoreCreateMutexStatic(&st->lock_buf);
+  st->flusher = NULL;
+}
+
+// Con el mutex tomado
+static void stage_flush_locked(uart_tx_stage_t *st)
+{
+  if (st->len > 0) {
+    stage_send(st, st->buf, st->len);
+    st->len = 0;
+  }
+}
+
+static void stage_poll_locked(uart_tx_stage_t *st)
+{
+  if (st->len > 0 && (xTaskGetTickCount() - st->first_tick) >= st->max_delay) {
+    stage_flush_locked(st);
+  }
+}
+
+void uart_tx_flush(uart_tx_stage_t *st)
+{
+  xSemaphoreTake(st->lock, portMAX_DELAY);
+  stage_flush_locked(st);
+  xSemaphoreGive(st->lock);
+}
+
+void uart_tx_poll(uart_tx_stage_t *st)
+{
+  xSemaphoreTake(st->lock, portMAX_DELAY);
+  stage_poll_locked(st);
+  xSemaphoreGive(st->lock);
+}
+
+void uart_tx_write(uart_tx_stage_t *st, const void *data, size_t len)
+{
+  const char *p = (const char *)data;
+  bool armed = false;
+
+  xSemaphoreTake(st->lock, portMAX_DELAY);
+  while (len > 0) {
+    if (st->len == 0) {
+      st->first_tick = xTaskGetTickCount();
+      armed = true;
+    }
+
+    // Copiar lo que entre hasta el umbral de tamaño
+    size_t room = st->flush_len - st->len;
+    size_t n = len < room ? len : room;
+    memcpy(&st->buf[st->len], p, n);
+    st->len += n;
+    p += n;
+    len -= n;
+
+    if (st->len >= st->flush_len) {
+      stage_flush_locked(st);
+    }
+  }
+
+  stage_poll_locked(st);
+  armed = armed && st->len > 0;
+  xSemaphoreGive(st->lock);
+
+  // Quedaron bytes con un plazo nuevo: que la tarea de envío lo tenga en cuenta
+  if (armed && st->flusher != NULL) {
+    xTaskNotifyGive(st->flusher->task);
+  }
+}
+
+void uart_tx_write_static(uart_tx_stage_t *st, const void *data, size_t len)
+{
+  xSemaphoreTake(st->lock, portMAX_DELAY);
+  stage_flush_locked(st);
+  stage_send(st, data, len);
+  xSemaphoreGive(st->lock);
+}
+
+//*****************************************************************************
+// Envío por plazo
+
+static void txFlusher(void *parameters)
+{
+  uart_tx_flusher_t *f = (uart_tx_flusher_t *)parameters;
+
+  while (1) {
+    TickType_t wait = portMAX_DELAY;
+    TickType_t now = xTaskGetTickCount();
+    // Las ranuras [0, num) ya están escritas (ver uart_tx_flusher_add)
+    size_t num = atomic_load_explicit(&f->num, memory_order_acquire);
+
+    for (size_t i = 0; i < num; i++) {
+      uart_tx_stage_t *st = f->stages[i];
+
+      // Si el dueño está escribiendo él mismo revisa el plazo; reintentar en un tick
+      if (xSemaphoreTake(st->lock, 0) != pdTRUE) {
+        wait = 1;
+        continue;
+      }
+      if (st->len > 0) {
+        TickType_t age = now - st->first_tick;
+        if (age >= st->max_delay) {
+          stage_flush_locked(st);
+        } else if (st->max_delay - age < wait) {
+          wait = st->max_delay - age;
+        }
+      }
+      xSemaphoreGive(st->lock);
+    }
+
+    // Un buffer que se llena después de revisarlo deja la notificación pendiente
+    ulTaskNotifyTake(pdTRUE, wait);
+  }
+}
+
+bool uart_tx_flusher_start(uart_tx_flusher_t *f, UBaseType_t priority, BaseType_t core)
+{
+  atomic_init(&f->num, 0);
+  return xTaskCreatePinnedToCore(txFlusher, "Envio TX", 2048, f, priority, &f->task, core) == pdPASS;
+}
+
+bool uart_tx_flusher_add(uart_tx_flusher_t *f, uart_tx_stage_t *st)
+{
+  size_t num = atomic_load_explicit(&f->num, memory_order_relaxed);
+
+  if (num >= UART_TX_FLUSHER_MAX) {
+    return false;
+  }
+  st->flusher = f;
+  f->stages[num] = st;
+  atomic_store_explicit(&f->num, num + 1, memory_order_release);
+  xTaskNotifyGive(f->task);
+
+  return true;
+}
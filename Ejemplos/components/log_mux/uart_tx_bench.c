@@ -0,0 +1,88 @@
+/**
+ *
+ * Resumen:
+ * Medición de la capa uart_tx: bytes por segundo y llamadas al backend por
+ * byte escribiendo un byte por llamada (como el ejemplo original), en lotes
+ * a través del buffer de preparación y con cadenas estáticas sin copia.
+ * Con el backend nulo se mide solo la capa; con el de la UART se suma el
+ * costo de uart_write_bytes. Cada caso entra en el buffer de transmisión del
+ * driver y se espera a que salga antes del siguiente, así el tiempo es de CPU
+ * y no de la línea.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "uart_tx.h"
+
+#include "bench_clock.h"
+
+// Configuración
+#define BENCH_BYTES     (896)   // Bytes por caso: menos que el buffer TX del driver (1024)
+
+static const char bench_msg[] = "tecnicas digitales en accion procesando en el nucleo 0\n";
+
+// Imprimir una línea de resultados
+static void bench_report(const char *name, uint32_t bytes, uint32_t calls, uint64_t us)
+{
+  printf("%-12s | bytes/s: %10.0f | llamadas/byte: %6.3f | us/llamada: %7.2f\n",
+         name,
+         us ? bytes * 1e6 / us : 0.0,
+         bytes ? (double)calls / bytes : 0.0,
+         calls ? (double)us / calls : 0.0);
+}
+
+// Esperar que el destino vacíe lo entregado (fuera de la medición)
+static void bench_drain(const uart_tx_backend_t *be)
+{
+  if (be->wait_done != NULL) {
+    be->wait_done(be->ctx);
+  }
+}
+
+void uart_tx_benchmark(const uart_tx_backend_t *be)
+{
+  const size_t len = strlen(bench_msg);
+  const int repeat = BENCH_BYTES / len;
+  uart_tx_stage_t st;
+  uint64_t t0;
+  uint32_t calls = 0;
+
+  printf("---Medición uart_tx (backend: %s, %d mensajes)---\n", be->name, repeat);
+
+  // Un byte por llamada al backend
+  bench_drain(be);
+  t0 = bench_now_us();
+  for (int r = 0; r < repeat; r++) {
+    for (size_t i = 0; i < len; i++) {
+      be->write(be->ctx, &bench_msg[i], 1);
+      calls++;
+    }
+  }
+  bench_report("byte a byte", repeat * len, calls, bench_now_us() - t0);
+
+  // Un byte por escritura, entregado en lotes por el buffer de preparación
+  bench_drain(be);
+  uart_tx_stage_init(&st, be, UART_TX_STAGE_LEN, portMAX_DELAY);
+  t0 = bench_now_us();
+  for (int r = 0; r < repeat; r++) {
+    for (size_t i = 0; i < len; i++) {
+      uart_tx_write(&st, &bench_msg[i], 1);
+    }
+  }
+  uart_tx_flush(&st);
+  bench_report("lotes", st.bytes, st.calls, bench_now_us() - t0);
+
+  // Mensaje completo sin copia
+  bench_drain(be);
+  uart_tx_stage_init(&st, be, UART_TX_STAGE_LEN, portMAX_DELAY);
+  t0 = bench_now_us();
+  for (int r = 0; r < repeat; r++) {
+    uart_tx_write_static(&st, bench_msg, len);
+  }
+  bench_report("estatico", st.bytes, st.calls, bench_now_us() - t0);
+  bench_drain(be);
+}
@@ -0,0 +1,92 @@
+/**
+ *
+ * Resumen:
+ * Perfilador de pila para todas las tareas del sistema. Cada muestra recorre
+ * las tareas con uxTaskGetSystemState (también IDLE, Tmr Svc, esp_timer e
+ * ipc) y guarda la marca de agua alta, es decir, la mínima pila libre desde
+ * que arrancó la tarea. Con eso obtiene el peor caso y recomienda un tamaño
+ * con un margen de seguridad configurable.
+ *
+ * - Componente compartido por los ejemplos (Ejemplos/components): cada
+ *   proyecto lo agrega con EXTRA_COMPONENT_DIRS y lo activa con
+ *   STACK_PROF_EN en su main.c.
+ * - Los handles solo se usan como clave: nunca se consulta una tarea que
+ *   pudo haberse borrado. Las tareas que desaparecen quedan en el informe
+ *   como terminadas, con su último peor caso.
+ * - FreeRTOS no guarda el tamaño pedido. Se deduce de los extremos de la
+ *   pila (uxTaskGetSnapshotAll), redondeado por la alineación y marcado con
+ *   "~". Si la tarea se crea con stack_prof_create o se registra con
+ *   stack_prof_register, se usa el tamaño exacto.
+ * - En ESP-IDF los tamaños de pila y la marca de agua están en bytes.
+ * - Requiere CONFIG_FREERTOS_USE_TRACE_FACILITY.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef STACK_PROF_H
+#define STACK_PROF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#if !configUSE_TRACE_FACILITY
+#error "stack_prof necesita CONFIG_FREERTOS_USE_TRACE_FACILITY=y"
+#endif
+
+#define STACK_PROF_MAX_TASKS    (24)
+#define STACK_PROF_MIN_MARGIN   (256)   // Margen mínimo en bytes (ISR, printf, etc.)
+#define STACK_PROF_ROUND        (64)    // Granularidad del tamaño recomendado
+#define STACK_PROF_DEFAULT_PERIOD_MS  (10000)   // Período de informe de los ejemplos
+#define STACK_PROF_DEFAULT_MARGIN     (20)      // Margen en % de los ejemplos
+
+typedef struct {
+  TaskHandle_t task;              // Solo como clave
+  char name[configMAX_TASK_NAME_LEN];
+  uint32_t stack_size;            // 0 si todavía no se conoce
+  bool exact;                     // Registrado (no deducido de la pila)
+  uint32_t min_free;              // Menor pila libre observada
+  bool sampled;
+  bool alive;                     // Presente en la última muestra
+} stack_prof_entry_t;
+
+/**
+ * @brief xTaskCreatePinnedToCore que además registra el tamaño exacto
+ */
+BaseType_t stack_prof_create(TaskFunction_t fn, const char *name, uint32_t stack_size,
+                             void *param, UBaseType_t prio, TaskHandle_t *handle,
+                             BaseType_t core);
+
+/**
+ * @brief Registrar el tamaño exacto de una tarea creada por otro medio
+ */
+bool stack_prof_register(TaskHandle_t task, const char *name, uint32_t stack_size);
+
+/**
+ * @brief Recorrer todas las tareas y actualizar su pila libre mínima
+ */
+void stack_prof_sample(void);
+
+/**
+ * @brief Tamaño recomendado para una pila con `used` bytes en el peor caso
+ *
+ * @param margin_pct Margen en porcentaje sobre lo usado (al menos STACK_PROF_MIN_MARGIN)
+ */
+uint32_t stack_prof_recommend(uint32_t used, uint32_t margin_pct);
+
+/**
+ * @brief Muestrear e imprimir por tarea: asignado, usado, recomendado y ahorro
+ */
+void stack_prof_report(uint32_t margin_pct);
+
+/**
+ * @brief Crear una tarea que muestrea e informa cada `period_ms`
+ *
+ * La marca de agua es acumulada: cada informe es el peor caso desde el
+ * arranque de cada tarea.
+ */
+bool stack_prof_start(uint32_t period_ms, uint32_t margin_pct, UBaseType_t priority, BaseType_t core);
+
+#endif // STACK_PROF_H
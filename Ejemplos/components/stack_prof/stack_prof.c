@@ -0,0 +1,279 @@
+/**
+ *
+ * Resumen:
+ * Implementación del perfilador de pila (ver stack_prof.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "stack_prof.h"
+
+// Extremos de la pila de cada tarea (solo en el ESP32)
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#define STACK_PROF_SNAPSHOT
+#endif
+
+#ifdef STACK_PROF_SNAPSHOT
+#include "esp_private/freertos_debug.h"
+#endif
+
+// Emparejamiento de una tarea de la muestra, calculado fuera de la sección crítica
+typedef struct {
+  int32_t entry;              // Índice en entries, o -1 si no estaba
+  uint32_t stack_size;        // Tamaño deducido del snapshot, o 0
+} sample_match_t;
+
+static stack_prof_entry_t entries[STACK_PROF_MAX_TASKS];
+static uint32_t num_entries;
+static uint32_t num_missed;         // Tareas sin lugar en la última muestra
+static portMUX_TYPE prof_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Periodo y margen de la tarea de informe
+static uint32_t report_period_ms;
+static uint32_t report_margin_pct;
+
+//*****************************************************************************
+// Tabla
+//
+// La tabla solo crece y la tarea y el nombre de una entrada no cambian después
+// de agregarla: las entradas [0, n) con n leído bajo prof_lock se pueden
+// recorrer sin él. add_entry y los demás campos, con prof_lock tomado.
+
+// Una tarea se identifica por handle y nombre: un handle reutilizado por
+// otra tarea (otro nombre) es una entrada nueva. Busca en [first, last).
+static int32_t find_entry(uint32_t first, uint32_t last, TaskHandle_t task, const char *name)
+{
+  for (uint32_t i = first; i < last; i++) {
+    if (entries[i].task == task && strncmp(entries[i].name, name, configMAX_TASK_NAME_LEN) == 0) {
+      return (int32_t)i;
+    }
+  }
+  return -1;
+}
+
+static stack_prof_entry_t *add_entry(TaskHandle_t task, const char *name)
+{
+  if (num_entries >= STACK_PROF_MAX_TASKS) {
+    return NULL;
+  }
+
+  stack_prof_entry_t *e = &entries[num_entries++];
+  e->task = task;
+  strncpy(e->name, name, configMAX_TASK_NAME_LEN - 1);
+  e->name[configMAX_TASK_NAME_LEN - 1] = '\0';
+  e->stack_size = 0;
+  e->exact = false;
+  e->min_free = UINT32_MAX;
+  e->sampled = false;
+  e->alive = true;
+  return e;
+}
+
+//*****************************************************************************
+// API
+
+bool stack_prof_register(TaskHandle_t task, const char *name, uint32_t stack_size)
+{
+  stack_prof_entry_t *e;
+  uint32_t known;
+
+  portENTER_CRITICAL(&prof_lock);
+  known = num_entries;
+  portEXIT_CRITICAL(&prof_lock);
+
+  int32_t idx = find_entry(0, known, task, name);
+
+  portENTER_CRITICAL(&prof_lock);
+  if (idx < 0) {
+    // Pudo agregarse mientras se buscaba
+    idx = find_entry(known, num_entries, task, name);
+  }
+  e = (idx >= 0) ? &entries[idx] : add_entry(task, name);
+  if (e != NULL) {
+    e->stack_size = stack_size;
+    e->exact = true;
+  }
+  portEXIT_CRITICAL(&prof_lock);
+
+  return e != NULL;
+}
+
+BaseType_t stack_prof_create(TaskFunction_t fn, const char *name, uint32_t stack_size,
+                             void *param, UBaseType_t prio, TaskHandle_t *handle,
+                             BaseType_t core)
+{
+  TaskHandle_t task = NULL;
+  BaseType_t res = xTaskCreatePinnedToCore(fn, name, stack_size, param, prio, &task, core);
+
+  if (res == pdPASS) {
+    stack_prof_register(task, name, stack_size);
+  }
+  if (handle != NULL) {
+    *handle = task;
+  }
+  return res;
+}
+
+void stack_prof_sample(void)
+{
+  // Margen por si se crean tareas entre contar y recorrer
+  UBaseType_t cap = uxTaskGetNumberOfTasks() + 4;
+  TaskStatus_t *status = pvPortMalloc(cap * sizeof(TaskStatus_t));
+  sample_match_t *match = pvPortMalloc(cap * sizeof(sample_match_t));
+  UBaseType_t n = 0;
+  uint32_t known;
+
+  if (status == NULL || match == NULL) {
+    vPortFree(match);
+    vPortFree(status);
+    return;
+  }
+  n = uxTaskGetSystemState(status, cap, NULL);
+
+#ifdef STACK_PROF_SNAPSHOT
+  UBaseType_t tcb_size;
+  TaskSnapshot_t *snap = pvPortMalloc(cap * sizeof(TaskSnapshot_t));
+  UBaseType_t num_snap = (snap != NULL) ? uxTaskGetSnapshotAll(snap, cap, &tcb_size) : 0;
+#endif
+
+  // Emparejar fuera de la sección crítica: búsqueda en la tabla y en los snapshots
+  portENTER_CRITICAL(&prof_lock);
+  known = num_entries;
+  portEXIT_CRITICAL(&prof_lock);
+
+  for (UBaseType_t k = 0; k < n; k++) {
+    match[k].entry = find_entry(0, known, status[k].xHandle, status[k].pcTaskName);
+    match[k].stack_size = 0;
+
+#ifdef STACK_PROF_SNAPSHOT
+    // Tamaño deducido: de la base a la dirección alta, más lo que se pierde al alinear
+    for (UBaseType_t s = 0; s < num_snap; s++) {
+      if (snap[s].pxTCB == (void *)status[k].xHandle) {
+        match[k].stack_size = (uint32_t)((uint8_t *)snap[s].pxEndOfStack - (uint8_t *)status[k].pxStackBase)
+                              + portBYTE_ALIGNMENT;
+        break;
+      }
+    }
+#endif
+  }
+
+#ifdef STACK_PROF_SNAPSHOT
+  vPortFree(snap);
+#endif
+
+  // Solo aplicar los resultados con prof_lock tomado. Las entradas nuevas
+  // desde `known` suelen ser ninguna o las que agrega esta misma muestra.
+  portENTER_CRITICAL(&prof_lock);
+  num_missed = 0;
+  for (uint32_t i = 0; i < num_entries; i++) {
+    entries[i].alive = false;
+  }
+
+  for (UBaseType_t k = 0; k < n; k++) {
+    int32_t idx = match[k].entry;
+
+    if (idx < 0) {
+      idx = find_entry(known, num_entries, status[k].xHandle, status[k].pcTaskName);
+    }
+    stack_prof_entry_t *e = (idx >= 0) ? &entries[idx] : add_entry(status[k].xHandle, status[k].pcTaskName);
+    if (e == NULL) {
+      num_missed++;
+      continue;
+    }
+
+    if (e->stack_size == 0) {
+      e->stack_size = match[k].stack_size;
+    }
+    if (status[k].usStackHighWaterMark < e->min_free) {
+      e->min_free = status[k].usStackHighWaterMark;
+    }
+    e->sampled = true;
+    e->alive = true;
+  }
+  portEXIT_CRITICAL(&prof_lock);
+
+  vPortFree(match);
+  vPortFree(status);
+}
+
+uint32_t stack_prof_recommend(uint32_t used, uint32_t margin_pct)
+{
+  uint32_t margin = used * margin_pct / 100;
+
+  if (margin < STACK_PROF_MIN_MARGIN) {
+    margin = STACK_PROF_MIN_MARGIN;
+  }
+  return (used + margin + STACK_PROF_ROUND - 1) / STACK_PROF_ROUND * STACK_PROF_ROUND;
+}
+
+void stack_prof_report(uint32_t margin_pct)
+{
+  stack_prof_entry_t copy[STACK_PROF_MAX_TASKS];
+  uint32_t n;
+  uint32_t missed;
+  int32_t saved = 0;
+
+  stack_prof_sample();
+
+  // Imprimir fuera de la sección crítica
+  portENTER_CRITICAL(&prof_lock);
+  n = num_entries;
+  missed = num_missed;
+  memcpy(copy, entries, n * sizeof(stack_prof_entry_t));
+  portEXIT_CRITICAL(&prof_lock);
+
+  printf("tarea            | asignado | usado máx | recomendado | ahorro  (margen %lu%%)\n",
+         (unsigned long)margin_pct);
+  for (uint32_t i = 0; i < n; i++) {
+    const stack_prof_entry_t *e = &copy[i];
+
+    if (!e->sampled) {
+      continue;
+    }
+    if (e->stack_size == 0) {
+      printf("%-16s |        ? |         ? |           ? |      ?  (libre mín %lu)\n",
+             e->name, (unsigned long)e->min_free);
+      continue;
+    }
+    uint32_t used = e->stack_size > e->min_free ? e->stack_size - e->min_free : 0;
+    uint32_t rec = stack_prof_recommend(used, margin_pct);
+    int32_t diff = (int32_t)e->stack_size - (int32_t)rec;
+
+    printf("%-16s | %c%7lu | %9lu | %11lu | %6ld%s%s\n",
+           e->name, e->exact ? ' ' : '~', (unsigned long)e->stack_size, (unsigned long)used,
+           (unsigned long)rec, (long)diff, diff < 0 ? "  (insuficiente)" : "",
+           e->alive ? "" : "  (terminada)");
+    if (e->alive) {
+      saved += diff;
+    }
+  }
+  printf("RAM recuperable: %ld bytes", (long)saved);
+  if (missed > 0) {
+    printf(" | %lu tareas sin lugar (STACK_PROF_MAX_TASKS)", (unsigned long)missed);
+  }
+  printf("\n");
+}
+
+//*****************************************************************************
+// Tarea de informe
+
+static void stackProfTask(void *parameters)
+{
+  while (1) {
+    vTaskDelay(report_period_ms / portTICK_PERIOD_MS);
+    stack_prof_report(report_margin_pct);
+  }
+}
+
+bool stack_prof_start(uint32_t period_ms, uint32_t margin_pct, UBaseType_t priority, BaseType_t core)
+{
+  report_period_ms = period_ms;
+  report_margin_pct = margin_pct;
+
+  return stack_prof_create(stackProfTask, "Stack prof", 3072, NULL, priority, NULL, core) == pdPASS;
+}
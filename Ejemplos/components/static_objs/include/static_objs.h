@@ -0,0 +1,153 @@
+/**
+ *
+ * Resumen:
+ * Tabla declarativa de tareas y objetos del kernel que se expande en tiempo
+ * de compilación a las variantes ...Static de FreeRTOS, con pilas y bloques
+ * de control reservados estáticamente: cero uso del heap al iniciar y un
+ * arranque determinista.
+ *
+ * La tabla es una macro que recibe un generador por tipo de objeto:
+ *
+ *   #define OBJS(TASK, QUEUE, MUTEX, COUNTING, TIMER) \
+ *     COUNTING(sem, 5, 0) \
+ *     TASK(tarea_1, doTask, "Tarea 1", 2048, NULL, 1, app_cpu) \
+ *     TIMER(tmr, "Temporizador", 100, pdTRUE, (void *)0, timerCb)
+ *
+ *   TASK(nombre, función, texto, pila, parámetro, prioridad, núcleo)
+ *   QUEUE(nombre, largo, tamaño del elemento)
+ *   MUTEX(nombre)
+ *   COUNTING(nombre, máximo, inicial)
+ *   TIMER(nombre, texto, periodo en ticks, recarga, id, callback)
+ *
+ * Uso (una sola vez, en el archivo que define las tareas y callbacks):
+ *   STATIC_OBJS_DECLARE(OBJS)                  handles y almacenamiento
+ *   STATIC_OBJS_CREATE_FN(OBJS, objs_create)   bool objs_create(void)
+ *   STATIC_OBJS_BENCH_FN(OBJS, objs_bench)     bool objs_bench(void)
+ *
+ * objs_create crea todo en el orden de la tabla y devuelve false si algún
+ * objeto no se pudo crear. objs_bench crea antes la misma tabla con
+ * asignación dinámica (tareas con una función que solo se suspende), mide
+ * tiempo y heap, la borra y luego hace la creación estática real midiendo
+ * lo mismo.
+ *
+ * En ESP-IDF la pila se expresa en bytes (StackType_t es uint8_t).
+ *
+ * Solo encabezado; usado por los Ejemplos 6 y 7.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef STATIC_OBJS_H
+#define STATIC_OBJS_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/timers.h"
+#include "esp_timer.h"
+
+//*****************************************************************************
+// Handles
+
+#define SO_HANDLE_TASK(n, fn, txt, stack, par, prio, core)    static TaskHandle_t n;
+#define SO_HANDLE_QUEUE(n, len, size)                         static QueueHandle_t n;
+#define SO_HANDLE_MUTEX(n)                                    static SemaphoreHandle_t n;
+#define SO_HANDLE_COUNTING(n, max, init)                      static SemaphoreHandle_t n;
+#define SO_HANDLE_TIMER(n, txt, per, rel, id, cb)             static TimerHandle_t n;
+
+//*****************************************************************************
+// Almacenamiento estático
+
+#define SO_STORAGE_TASK(n, fn, txt, stack, par, prio, core) \
+  static StackType_t n##_stack[stack]; static StaticTask_t n##_tcb;
+#define SO_STORAGE_QUEUE(n, len, size) \
+  static uint8_t n##_items[(len) * (size)]; static StaticQueue_t n##_qcb;
+#define SO_STORAGE_MUTEX(n)                                   static StaticSemaphore_t n##_scb;
+#define SO_STORAGE_COUNTING(n, max, init)                     static StaticSemaphore_t n##_scb;
+#define SO_STORAGE_TIMER(n, txt, per, rel, id, cb)            static StaticTimer_t n##_tcb;
+
+//*****************************************************************************
+// Creación estática
+
+#define SO_STATIC_TASK(n, fn, txt, stack, par, prio, core) \
+  n = xTaskCreateStaticPinnedToCore(fn, txt, stack, par, prio, n##_stack, &n##_tcb, core); ok &= (n != NULL);
+#define SO_STATIC_QUEUE(n, len, size) \
+  n = xQueueCreateStatic(len, size, n##_items, &n##_qcb); ok &= (n != NULL);
+#define SO_STATIC_MUTEX(n) \
+  n = xSemaphoreCreateMutexStatic(&n##_scb); ok &= (n != NULL);
+#define SO_STATIC_COUNTING(n, max, init) \
+  n = xSemaphoreCreateCountingStatic(max, init, &n##_scb); ok &= (n != NULL);
+#define SO_STATIC_TIMER(n, txt, per, rel, id, cb) \
+  n = xTimerCreateStatic(txt, per, rel, id, cb, &n##_tcb); ok &= (n != NULL);
+
+//*****************************************************************************
+// Creación dinámica y borrado (solo para la medición)
+
+#define SO_DYN_TASK(n, fn, txt, stack, par, prio, core) \
+  TaskHandle_t n = NULL; xTaskCreatePinnedToCore(so_park_task, txt, stack, NULL, prio, &n, core); ok &= (n != NULL);
+#define SO_DYN_QUEUE(n, len, size) \
+  QueueHandle_t n = xQueueCreate(len, size); ok &= (n != NULL);
+#define SO_DYN_MUTEX(n) \
+  SemaphoreHandle_t n = xSemaphoreCreateMutex(); ok &= (n != NULL);
+#define SO_DYN_COUNTING(n, max, init) \
+  SemaphoreHandle_t n = xSemaphoreCreateCounting(max, init); ok &= (n != NULL);
+#define SO_DYN_TIMER(n, txt, per, rel, id, cb) \
+  TimerHandle_t n = xTimerCreate(txt, per, rel, id, cb); ok &= (n != NULL);
+
+#define SO_DEL_TASK(n, fn, txt, stack, par, prio, core)       if (n) { vTaskDelete(n); }
+#define SO_DEL_QUEUE(n, len, size)                            if (n) { vQueueDelete(n); }
+#define SO_DEL_MUTEX(n)                                       if (n) { vSemaphoreDelete(n); }
+#define SO_DEL_COUNTING(n, max, init)                         if (n) { vSemaphoreDelete(n); }
+#define SO_DEL_TIMER(n, txt, per, rel, id, cb)                if (n) { xTimerDelete(n, portMAX_DELAY); }
+
+//*****************************************************************************
+// Expansión de la tabla
+
+#define STATIC_OBJS_DECLARE(TABLE) \
+  TABLE(SO_HANDLE_TASK, SO_HANDLE_QUEUE, SO_HANDLE_MUTEX, SO_HANDLE_COUNTING, SO_HANDLE_TIMER) \
+  TABLE(SO_STORAGE_TASK, SO_STORAGE_QUEUE, SO_STORAGE_MUTEX, SO_STORAGE_COUNTING, SO_STORAGE_TIMER)
+
+#define STATIC_OBJS_CREATE_FN(TABLE, fname) \
+  static bool fname(void) \
+  { \
+    bool ok = true; \
+    TABLE(SO_STATIC_TASK, SO_STATIC_QUEUE, SO_STATIC_MUTEX, SO_STATIC_COUNTING, SO_STATIC_TIMER) \
+    return ok; \
+  }
+
+// La creación estática que se mide es la real: la función reemplaza a la de creación
+#define STATIC_OBJS_BENCH_FN(TABLE, fname) \
+  STATIC_OBJS_CREATE_FN(TABLE, fname##_static) \
+  static __attribute__((unused)) void so_park_task(void *parameters) \
+  { \
+    while (1) { \
+      vTaskSuspend(NULL); \
+    } \
+  } \
+  static bool fname(void) \
+  { \
+    bool ok = true; \
+    size_t heap0 = xPortGetFreeHeapSize(); \
+    int64_t t0 = esp_timer_get_time(); \
+    { \
+      TABLE(SO_DYN_TASK, SO_DYN_QUEUE, SO_DYN_MUTEX, SO_DYN_COUNTING, SO_DYN_TIMER) \
+      int64_t dyn_us = esp_timer_get_time() - t0; \
+      long dyn_heap = (long)heap0 - (long)xPortGetFreeHeapSize(); \
+      TABLE(SO_DEL_TASK, SO_DEL_QUEUE, SO_DEL_MUTEX, SO_DEL_COUNTING, SO_DEL_TIMER) \
+      printf("dinámica | %6ld us | heap usado: %6ld bytes\n", (long)dyn_us, dyn_heap); \
+    } \
+    /* Dejar que la tarea inactiva y la de temporizadores liberen lo borrado */ \
+    vTaskDelay(10); \
+    heap0 = xPortGetFreeHeapSize(); \
+    t0 = esp_timer_get_time(); \
+    ok &= fname##_static(); \
+    printf("estática | %6ld us | heap usado: %6ld bytes\n", \
+           (long)(esp_timer_get_time() - t0), (long)heap0 - (long)xPortGetFreeHeapSize()); \
+    return ok; \
+  }
+
+#endif // STATIC_OBJS_H
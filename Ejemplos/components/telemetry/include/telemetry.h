@@ -0,0 +1,91 @@
+/**
+ *
+ * Resumen:
+ * Telemetría binaria en tramas para reemplazar un printf por muestra.
+ * Cada trama lleva muchas muestras, número de secuencia, marca de tiempo y
+ * CRC-16, y se delimita con COBS (el byte 0x00 solo aparece al inicio y al
+ * final), por lo que el receptor se resincroniza solo aunque se mezcle con
+ * texto de consola.
+ *
+ * Trama antes de COBS (little endian):
+ *   versión(1) formato(1) canal(1) secuencia(2) t0_us(8) periodo_us(4)
+ *   cantidad(2) muestras(...) crc16(2)
+ *
+ * t0_us es la marca real de la primera muestra (esp_timer_get_time, 64 bits:
+ * no da la vuelta); con 32 bits daba la vuelta a los 71 minutos.
+ *
+ * Componente compartido por los ejemplos (Ejemplos/components): lo usan el
+ * Ejemplo4 y el Ejemplo8. Este archivo no depende de FreeRTOS ni de
+ * ESP-IDF: lo usa también la herramienta de host tools/telemetry_decode.c.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TELEM_VERSION         (2)
+#define TELEM_HEADER_LEN      (19)
+#define TELEM_CRC_LEN         (2)
+#define TELEM_MAX_SAMPLES     (128)
+
+// Formatos de muestra
+#define TELEM_FMT_I16         (1)     // int16 little endian, 2 bytes por muestra
+#define TELEM_FMT_U12         (2)     // 12 bits empaquetados, 1.5 bytes por muestra (ADC)
+
+// Tamaños máximos: trama cruda y trama codificada (COBS + delimitadores)
+#define TELEM_MAX_RAW         (TELEM_HEADER_LEN + 2 * TELEM_MAX_SAMPLES + TELEM_CRC_LEN)
+#define TELEM_MAX_FRAME       (TELEM_MAX_RAW + TELEM_MAX_RAW / 254 + 3)
+
+// Encabezado decodificado
+typedef struct {
+  uint8_t format;
+  uint8_t channel;
+  uint16_t seq;
+  uint64_t t0_us;         // Marca de tiempo de la primera muestra
+  uint32_t period_us;     // Separación entre muestras
+  uint16_t count;
+} telem_header_t;
+
+// Estado del codificador (uno por flujo)
+typedef struct {
+  uint8_t format;
+  uint8_t channel;
+  uint16_t seq;
+  uint8_t raw[TELEM_MAX_RAW];
+} telem_enc_t;
+
+void telem_enc_init(telem_enc_t *enc, uint8_t channel, uint8_t format);
+
+/**
+ * @brief Codificar hasta TELEM_MAX_SAMPLES muestras en una trama lista para enviar
+ *
+ * @param out Destino de al menos TELEM_MAX_FRAME bytes
+ * @return Bytes escritos en `out` (incluye los delimitadores 0x00)
+ */
+size_t telem_encode(telem_enc_t *enc, uint64_t t0_us, uint32_t period_us,
+                    const int16_t *samples, size_t n, uint8_t *out);
+
+//*****************************************************************************
+// Decodificación (host)
+
+/**
+ * @brief Deshacer COBS de una trama sin su delimitador
+ *
+ * @return Bytes decodificados o 0 si la trama es inválida
+ */
+size_t telem_cobs_decode(const uint8_t *in, size_t len, uint8_t *out);
+
+/**
+ * @brief Verificar el CRC y extraer encabezado y muestras de una trama cruda
+ */
+bool telem_parse(const uint8_t *raw, size_t len, telem_header_t *hdr, int16_t *samples);
+
+uint16_t telem_crc16(const uint8_t *data, size_t len);
+
+#endif // TELEMETRY_H
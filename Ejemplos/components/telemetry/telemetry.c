@@ -0,0 +1,232 @@
+/**
+ *
+ * Resumen:
+ * Codificador y decodificador de tramas de telemetría (ver telemetry.h).
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <string.h>
+#include "telemetry.h"
+
+//*****************************************************************************
+// CRC-16/CCITT-FALSE (polinomio 0x1021, valor inicial 0xFFFF), tabla de 4 bits
+
+static const uint16_t crc_nibble[16] = {
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+  0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+};
+
+uint16_t telem_crc16(const uint8_t *data, size_t len)
+{
+  uint16_t crc = 0xFFFF;
+
+  for (size_t i = 0; i < len; i++) {
+    crc = (crc << 4) ^ crc_nibble[((crc >> 12) ^ (data[i] >> 4)) & 0x0F];
+    crc = (crc << 4) ^ crc_nibble[((crc >> 12) ^ (data[i] & 0x0F)) & 0x0F];
+  }
+  return crc;
+}
+
+//*****************************************************************************
+// Utilidades little endian
+
+static inline uint8_t *put_u16(uint8_t *p, uint16_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  return p + 2;
+}
+
+static inline uint8_t *put_u32(uint8_t *p, uint32_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+  return p + 4;
+}
+
+static inline uint8_t *put_u64(uint8_t *p, uint64_t v)
+{
+  p = put_u32(p, (uint32_t)v);
+  return put_u32(p, (uint32_t)(v >> 32));
+}
+
+static inline uint16_t get_u16(const uint8_t *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t get_u32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint64_t get_u64(const uint8_t *p)
+{
+  return (uint64_t)get_u32(p) | ((uint64_t)get_u32(p + 4) << 32);
+}
+
+//*****************************************************************************
+// COBS
+
+// Codificar `len` bytes; el resultado nunca contiene 0x00
+static size_t cobs_encode(const uint8_t *in, size_t len, uint8_t *out)
+{
+  size_t code_pos = 0;
+  size_t o = 1;
+  uint8_t code = 1;
+
+  for (size_t i = 0; i < len; i++) {
+    if (in[i] == 0) {
+      out[code_pos] = code;
+      code_pos = o++;
+      code = 1;
+    } else {
+      out[o++] = in[i];
+      code++;
+      if (code == 0xFF) {
+        out[code_pos] = code;
+        code_pos = o++;
+        code = 1;
+      }
+    }
+  }
+  out[code_pos] = code;
+
+  return o;
+}
+
+size_t telem_cobs_decode(const uint8_t *in, size_t len, uint8_t *out)
+{
+  size_t i = 0;
+  size_t o = 0;
+
+  while (i < len) {
+    uint8_t code = in[i++];
+    if (code == 0 || i + code - 1 > len) {
+      return 0;
+    }
+    for (uint8_t j = 1; j < code; j++) {
+      out[o++] = in[i++];
+    }
+    if (code < 0xFF && i < len) {
+      out[o++] = 0;
+    }
+  }
+
+  return o;
+}
+
+//*****************************************************************************
+// Codificador
+
+void telem_enc_init(telem_enc_t *enc, uint8_t channel, uint8_t format)
+{
+  enc->format = format;
+  enc->channel = channel;
+  enc->seq = 0;
+}
+
+size_t telem_encode(telem_enc_t *enc, uint64_t t0_us, uint32_t period_us,
+                    const int16_t *samples, size_t n, uint8_t *out)
+{
+  uint8_t *p = enc->raw;
+
+  if (n > TELEM_MAX_SAMPLES) {
+    n = TELEM_MAX_SAMPLES;
+  }
+
+  // Encabezado
+  *p++ = TELEM_VERSION;
+  *p++ = enc->format;
+  *p++ = enc->channel;
+  p = put_u16(p, enc->seq++);
+  p = put_u64(p, t0_us);
+  p = put_u32(p, period_us);
+  p = put_u16(p, (uint16_t)n);
+
+  // Muestras
+  if (enc->format == TELEM_FMT_U12) {
+    // Dos muestras de 12 bits en tres bytes
+    size_t i = 0;
+    for (; i + 1 < n; i += 2) {
+      uint16_t a = (uint16_t)samples[i] & 0x0FFF;
+      uint16_t b = (uint16_t)samples[i + 1] & 0x0FFF;
+      *p++ = (uint8_t)a;
+      *p++ = (uint8_t)((a >> 8) | (b << 4));
+      *p++ = (uint8_t)(b >> 4);
+    }
+    if (i < n) {
+      p = put_u16(p, (uint16_t)samples[i] & 0x0FFF);
+    }
+  } else {
+    for (size_t i = 0; i < n; i++) {
+      p = put_u16(p, (uint16_t)samples[i]);
+    }
+  }
+
+  p = put_u16(p, telem_crc16(enc->raw, p - enc->raw));
+
+  // Delimitar con COBS y un 0x00 a cada lado: el inicial separa la trama de
+  // cualquier texto de consola que se haya enviado antes
+  out[0] = 0x00;
+  size_t len = 1 + cobs_encode(enc->raw, p - enc->raw, out + 1);
+  out[len++] = 0x00;
+
+  return len;
+}
+
+//*****************************************************************************
+// Decodificador
+
+bool telem_parse(const uint8_t *raw, size_t len, telem_header_t *hdr, int16_t *samples)
+{
+  if (len < TELEM_HEADER_LEN + TELEM_CRC_LEN || raw[0] != TELEM_VERSION) {
+    return false;
+  }
+  if (telem_crc16(raw, len - TELEM_CRC_LEN) != get_u16(&raw[len - TELEM_CRC_LEN])) {
+    return false;
+  }
+
+  hdr->format = raw[1];
+  hdr->channel = raw[2];
+  hdr->seq = get_u16(&raw[3]);
+  hdr->t0_us = get_u64(&raw[5]);
+  hdr->period_us = get_u32(&raw[13]);
+  hdr->count = get_u16(&raw[17]);
+  if (hdr->count > TELEM_MAX_SAMPLES) {
+    return false;
+  }
+
+  const uint8_t *p = &raw[TELEM_HEADER_LEN];
+  size_t payload = len - TELEM_HEADER_LEN - TELEM_CRC_LEN;
+  size_t n = hdr->count;
+
+  if (hdr->format == TELEM_FMT_U12) {
+    if (payload != (n / 2) * 3 + (n % 2) * 2) {
+      return false;
+    }
+    size_t i = 0;
+    for (; i + 1 < n; i += 2, p += 3) {
+      samples[i] = (int16_t)(p[0] | ((p[1] & 0x0F) << 8));
+      samples[i + 1] = (int16_t)((p[1] >> 4) | (p[2] << 4));
+    }
+    if (i < n) {
+      samples[i] = (int16_t)get_u16(p);
+    }
+  } else if (hdr->format == TELEM_FMT_I16) {
+    if (payload != 2 * n) {
+      return false;
+    }
+    for (size_t i = 0; i < n; i++, p += 2) {
+      samples[i] = (int16_t)get_u16(p);
+    }
+  } else {
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,121 @@
+/**
+ *
+ * Resumen:
+ * Herramienta de host que convierte el flujo binario de telemetría de los
+ * Ejemplos 4 y 8 en CSV (secuencia, canal, tiempo en us, valor). El texto de
+ * consola mezclado con las tramas se descarta porque no pasa la verificación
+ * de CRC.
+ *
+ * Compilar:  gcc -O2 -I../include -o telemetry_decode telemetry_decode.c ../telemetry.c
+ * Uso:       telemetry_decode captura.bin > datos.csv
+ *            cat /dev/ttyUSB0 | telemetry_decode > datos.csv
+ *            telemetry_decode -r captura.bin    (captura sin conversión LF -> CRLF)
+ *
+ * La consola de ESP-IDF (CONFIG_NEWLIB_STDOUT_LINE_ENDING_CRLF) convierte
+ * cada 0x0A de la trama en 0x0D 0x0A, lo que rompe el CRC; por defecto se
+ * deshace esa conversión, igual que en dlog_decode del Ejemplo9.
+ * Las tramas inválidas y los saltos de secuencia se informan por stderr.
+ *
+ * Fecha: 17/10/2026
+ * Autores: Espindola Agustin, Glas Sebastian
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "telemetry.h"
+
+static FILE *in;
+static int undo_crlf = 1;
+
+// Leer un byte deshaciendo la conversión LF -> CRLF de la consola
+static int next_byte(void)
+{
+  int c = fgetc(in);
+
+  if (undo_crlf && c == '\r') {
+    int d = fgetc(in);
+    if (d == '\n') {
+      return d;
+    }
+    if (d != EOF) {
+      ungetc(d, in);
+    }
+  }
+  return c;
+}
+
+int main(int argc, char *argv[])
+{
+  uint8_t enc[TELEM_MAX_FRAME];
+  uint8_t raw[TELEM_MAX_FRAME];
+  int16_t samples[TELEM_MAX_SAMPLES];
+  telem_header_t hdr;
+  size_t len = 0;
+  int c;
+
+  unsigned long frames = 0, bad = 0, lost = 0;
+  int have_seq = 0;
+  uint16_t next_seq = 0;
+
+  in = stdin;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-r") == 0) {
+      undo_crlf = 0;
+    } else {
+      in = fopen(argv[i], "rb");
+      if (in == NULL) {
+        perror(argv[i]);
+        return 1;
+      }
+    }
+  }
+
+  printf("seq,canal,t_us,valor\n");
+
+  while ((c = next_byte()) != EOF) {
+    if (c != 0x00) {
+      // Acumular hasta el delimitador; una trama demasiado larga se descarta
+      if (len < sizeof(enc)) {
+        enc[len] = (uint8_t)c;
+      }
+      len++;
+      continue;
+    }
+
+    // Fin de trama
+    if (len == 0) {
+      continue;
+    }
+    size_t n = (len <= sizeof(enc)) ? telem_cobs_decode(enc, len, raw) : 0;
+    len = 0;
+
+    if (n == 0 || !telem_parse(raw, n, &hdr, samples)) {
+      bad++;
+      continue;
+    }
+
+    // Detectar tramas perdidas por la secuencia
+    if (have_seq && hdr.seq != next_seq) {
+      uint16_t gap = (uint16_t)(hdr.seq - next_seq);
+      fprintf(stderr, "salto de secuencia: esperada %u, recibida %u (%u tramas)\n",
+              next_seq, hdr.seq, gap);
+      lost += gap;
+    }
+    have_seq = 1;
+    next_seq = hdr.seq + 1;
+    frames++;
+
+    for (uint16_t i = 0; i < hdr.count; i++) {
+      printf("%u,%u,%llu,%d\n", hdr.seq, hdr.channel,
+             (unsigned long long)(hdr.t0_us + (uint64_t)i * hdr.period_us), samples[i]);
+    }
+  }
+
+  fprintf(stderr, "tramas: %lu | inválidas: %lu | perdidas: %lu\n", frames, bad, lost);
+
+  if (in != stdin) {
+    fclose(in);
+  }
+  return 0;
+}